@@ -0,0 +1,58 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include <fstream>
+#include <iterator>
+
+#include "../system/system.h"
+#include "../rv64/rv64-cpu.h"
+
+static uint64_t Micro(uint64_t ns) {
+	return ns / 1000;
+}
+static uint64_t Percent(uint64_t part, uint64_t total) {
+	return (total == 0 ? 0 : (100 * part / total));
+}
+
+int main(int argc, char** argv) {
+	util::ConfigureLogging(false);
+
+	if (argc != 2) {
+		str::PrintLn(u8"Invalid usage. Expected path to a riscv64 elf file.");
+		return 1;
+	}
+
+	/* read the elf file into memory */
+	std::ifstream _in{ argv[1], std::ios::in | std::ios::binary };
+	if (!_in) {
+		str::PrintLn(u8"Failed to open [", argv[1], u8']');
+		return 1;
+	}
+	std::vector<uint8_t> data{ std::istreambuf_iterator<char>{ _in }, std::istreambuf_iterator<char>{} };
+
+	/* translate the entire elf natively */
+	sys::BenchResult result;
+	if (!sys::TranslateBench::Run(rv64::Cpu::New(), std::move(data), result)) {
+		str::PrintLn(u8"Failed to benchmark the translation of [", argv[1], u8']');
+		return 1;
+	}
+
+	/* print the results (emission is only the finalization, as function-bodies are encoded while translating) */
+	const gen::Statistics& stats = result.statistics;
+	uint64_t otherNS = result.totalNS - std::min(result.totalNS, stats.decodeNS + stats.rangesNS + stats.translateNS + result.emitNS);
+	uint64_t instPerSec = stats.decoded * 1000'000'000 / std::max<uint64_t>(result.totalNS, 1);
+	uint64_t bytesPerInst = 100 * result.wasmBytes / std::max<uint64_t>(stats.produced, 1);
+	str::PrintLn(u8"Binary      : ", argv[1]);
+	str::PrintLn(u8"Super-Blocks: ", stats.blocks);
+	str::PrintLn(u8"Decoded     : ", stats.decoded);
+	str::PrintLn(u8"Produced    : ", stats.produced);
+	str::PrintLn(u8"Wasm Bytes  : ", result.wasmBytes);
+	str::PrintLn(u8"Inst/Sec    : ", instPerSec);
+	str::PrintLn(u8"Bytes/Inst  : ", bytesPerInst / 100, u8'.', str::As{ U"02", bytesPerInst % 100 });
+	str::PrintLn(u8"Total       : ", Micro(result.totalNS), u8" us");
+	str::PrintLn(u8"  Decode    : ", Micro(stats.decodeNS), u8" us (", Percent(stats.decodeNS, result.totalNS), u8"%)");
+	str::PrintLn(u8"  Ranges    : ", Micro(stats.rangesNS), u8" us (", Percent(stats.rangesNS, result.totalNS), u8"%)");
+	str::PrintLn(u8"  Translate : ", Micro(stats.translateNS), u8" us (", Percent(stats.translateNS, result.totalNS), u8"%)");
+	str::PrintLn(u8"  Emission  : ", Micro(result.emitNS), u8" us (", Percent(result.emitNS, result.totalNS), u8"%)");
+	str::PrintLn(u8"  Other     : ", Micro(otherNS), u8" us (", Percent(otherNS, result.totalNS), u8"%)");
+	return 0;
+}
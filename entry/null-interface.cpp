@@ -6,9 +6,15 @@
 void host_task(const char8_t* task, uint32_t size, uint32_t process) {
 	main_task_completed(process, 0, 0);
 }
+void host_binary_task(const void* request, uint32_t process) {
+	main_task_completed(process, 0, 0);
+}
 void host_message(const char8_t* data, uint32_t size) {
 	str::BuildTo(std::cout, std::u8string_view{ data, size }, u8'\n');
 }
+void host_output(const char8_t* data, uint32_t size) {
+	str::BuildTo(std::cout, std::u8string_view{ data, size });
+}
 void host_failure(const char8_t* data, uint32_t size) {
 	str::BuildTo(std::cerr, u8"Fatal Exception: ", std::u8string_view{ data, size }, u8'\n');
 }
@@ -16,6 +22,8 @@ uint32_t host_random() { return 123; }
 uint64_t host_time_us() { return 0; }
 int32_t host_timezone_min() { return 0; }
 void host_check_metrics() {}
+uint32_t host_perf_map() { return 0; }
+void host_perf_symbol(const char8_t* data, uint32_t size) {}
 
 uint32_t glue_setup_core_map() { return 1; }
 void glue_reset_core_map() {}
@@ -12,6 +12,8 @@ struct NullSystem final : public env::System {
 	}
 	void coreLoaded() final {}
 	std::vector<env::BlockExport> setupBlock(wasm::Module& mod) final { return {}; }
+	const env::WarmBlock* warmBlock() final { return 0; }
+	void blockProduced(const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports) final {}
 	void blockLoaded() final {}
 	void shutdown() final {}
 };
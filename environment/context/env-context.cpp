@@ -29,3 +29,12 @@ void env::Context::fCodeException(env::guest_t address, detail::CodeExceptions i
 void env::Context::terminate(int32_t code, env::guest_t address) {
 	fTerminate(code, address);
 }
+std::vector<uint8_t> env::Context::save() const {
+	return pBuffer;
+}
+void env::Context::restore(const std::vector<uint8_t>& state) {
+	/* the context-size is fixed by the system and must therefore never change */
+	if (state.size() != pBuffer.size())
+		logger.fatal(u8"Cannot restore context of size [", state.size(), u8"] into context of size [", pBuffer.size(), u8']');
+	std::copy(state.begin(), state.end(), pBuffer.begin());
+}
@@ -35,6 +35,8 @@ namespace env {
 
 	public:
 		void terminate(int32_t code, env::guest_t address);
+		std::vector<uint8_t> save() const;
+		void restore(const std::vector<uint8_t>& state);
 		template <class Type>
 		const Type& get() const {
 			fCheck(sizeof(Type));
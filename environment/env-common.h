@@ -73,6 +73,18 @@ namespace env {
 		env::guest_t address = 0;
 	};
 
+	/* previously produced block module, which can be loaded again without being configured */
+	struct WarmBlock {
+		std::vector<uint8_t> data;
+		std::vector<env::BlockExport> exports;
+	};
+
+	/* contiguous range of the physical guest memory, which backs a range of virtual guest memory (only valid until the mappings change) */
+	struct PhysicalRange {
+		uint64_t physical = 0;
+		uint64_t size = 0;
+	};
+
 	/* system interface is used to setup and configure the environment accordingly and interact with it
 	*	Note: wasm should only be generated within setupCore/setupBlock, as they are wrapped to catch any potential wasm-issues */
 	class System {
@@ -92,6 +104,12 @@ namespace env {
 		/* invoked for every new block module to be configured, after being triggered to be created */
 		virtual std::vector<env::BlockExport> setupBlock(wasm::Module& mod) = 0;
 
+		/* invoked before every new block module is configured, to allow a previously produced module to be loaded instead (null to configure the block) */
+		virtual const env::WarmBlock* warmBlock() = 0;
+
+		/* invoked with the binary output of every configured block module */
+		virtual void blockProduced(const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports) = 0;
+
 		/* invoked when the last configured block has been loaded */
 		virtual void blockLoaded() = 0;
 
@@ -5,76 +5,60 @@
 
 static util::Logger logger{ u8"env::filesystem" };
 
-bool env::FileSystem::fHandleTask(const std::u8string& task, std::function<void(json::Reader<std::u8string_view>)> callback) {
-	return detail::ProcessAccess::HandleTask(task, [callback](std::u8string_view response, bool) {
-		if (response.empty())
-			response = u8"null";
-		try {
-			callback(json::Read(response));
-		}
-		catch (const json::Exception& e) {
-			logger.fatal(u8"Malformed json-response encountered: ", e.what());
-		}
+bool env::FileSystem::fHandleTask(detail::TaskOpcode opcode, std::initializer_list<uint64_t> args, const void* data, size_t size, std::function<void(std::u8string_view)> callback) {
+	/* setup the request (only needs to remain valid until the host has been invoked, as it decodes the request immediately) */
+	detail::TaskRequest request{ .opcode = uint32_t(opcode), .size = uint32_t(size), .data = uint64_t(uintptr_t(data)) };
+	std::copy(args.begin(), args.end(), request.args);
+
+	pInplace = detail::ProcessAccess::HandleTask(request, [callback](std::u8string_view response, bool) {
+		callback(response);
 		});
+	return pInplace;
+}
+bool env::FileSystem::completesInplace() const {
+	return pInplace;
 }
-env::FileStats env::FileSystem::fParseStats(json::ObjReader<std::u8string_view> obj) const {
+std::optional<uint64_t> env::FileSystem::fParseValue(std::u8string_view response) const {
+	if (response.empty())
+		return std::nullopt;
+	if (response.size() != sizeof(uint64_t))
+		logger.fatal(u8"Received malformed value of size [", response.size(), u8']');
+
+	uint64_t value = 0;
+	std::memcpy(&value, response.data(), sizeof(uint64_t));
+	return value;
+}
+env::FileStats env::FileSystem::fParseStats(std::u8string_view& response, std::u8string* name) const {
+	detail::TaskStats record;
 	env::FileStats out;
-	uint16_t required = 0b0001'1111'1111;
 
-	/* iterate over the attributes and apply them */
-	for (const auto& [key, value] : obj) {
-		if (key == "mtime_us") {
-			out.timeModifiedUS = value.unum();
-			required &= ~0b0001'0000'0000;
-		}
-		else if (key == "atime_us") {
-			out.timeAccessedUS = value.unum();
-			required &= ~0b0000'1000'0000;
-		}
-		else if (key == "size") {
-			out.size = value.unum();
-			required &= ~0b0000'0100'0000;
-		}
-		else if (key == "type") {
-			const std::string& _type = value.str();
-			if (_type == "file")
-				out.type = env::FileType::file;
-			else if (_type == "dir")
-				out.type = env::FileType::directory;
-			else if (_type == "link")
-				out.type = env::FileType::link;
-			else
-				logger.fatal(u8"Received invalid file-type [", _type, u8']');
-			required &= ~0b0000'0010'0000;
-		}
-		else if (key == "link") {
-			out.link = str::u8::Safe(value.str());
-			required &= ~0b0000'0001'0000;
-		}
-		else if (key == "owner") {
-			out.access.owner = uint32_t(value.unum());
-			required &= ~0b0000'0000'1000;
-		}
-		else if (key == "group") {
-			out.access.group = uint32_t(value.unum());
-			required &= ~0b0000'0000'0100;
-		}
-		else if (key == "permissions") {
-			out.access.permissions.all = uint16_t(value.unum() & env::fileModeMask);
-			required &= ~0b0000'0000'0010;
-		}
-		else if (key == "id") {
-			out.id = value.unum();
-			required &= ~0b0000'0000'0001;
-		}
-	}
+	/* validate and consume the fixed-layout record, and its trailing name and link */
+	if (response.size() < sizeof(detail::TaskStats))
+		logger.fatal(u8"Received incomplete file-stats");
+	std::memcpy(&record, response.data(), sizeof(detail::TaskStats));
+	size_t total = sizeof(detail::TaskStats) + size_t(record.nameSize) + size_t(record.linkSize);
+	if (response.size() < total)
+		logger.fatal(u8"Received incomplete file-stats");
+	std::u8string_view strings = response.substr(sizeof(detail::TaskStats));
+	if (name != 0)
+		*name = std::u8string{ strings.substr(0, record.nameSize) };
+	out.link = std::u8string{ strings.substr(record.nameSize, record.linkSize) };
+	response = response.substr(std::min(response.size(), (total + 7) & ~size_t(7)));
+
+	/* apply the attributes */
+	if (record.type > uint8_t(env::FileType::link))
+		logger.fatal(u8"Received invalid file-type [", uint32_t(record.type), u8']');
+	out.type = env::FileType(record.type);
+	out.timeModifiedUS = record.timeModifiedUS;
+	out.timeAccessedUS = record.timeAccessedUS;
+	out.size = record.size;
+	out.id = record.id;
+	out.access.owner = record.owner;
+	out.access.group = record.group;
+	out.access.permissions.all = uint16_t(record.permissions & env::fileModeMask);
 
 	/* mark the system as not-virtualized */
 	out.virtualized = false;
-
-	/* check if all values have been received and return the parsed stats */
-	if (required != 0)
-		logger.fatal(u8"Received incomplete file-stats");
 	return out;
 }
 
@@ -91,99 +75,99 @@ void env::FileSystem::readStats(std::u8string_view path, std::function<void(cons
 	logger.debug(u8"Reading stats of [", actual, u8']');
 
 	/* queue the task */
-	fHandleTask(str::u8::Build(u8"resolve:", actual), [this, callback](json::Reader<std::u8string_view> resp) {
-		if (resp.isNull())
+	fHandleTask(detail::TaskOpcode::resolve, {}, actual.data(), actual.size(), [this, callback](std::u8string_view resp) {
+		if (resp.empty())
 			callback(0);
 		else {
-			env::FileStats stats = fParseStats(resp.obj());
+			env::FileStats stats = fParseStats(resp, 0);
 			callback(&stats);
 		}
 		});
 }
 void env::FileSystem::readStats(uint64_t id, std::u8string_view name, std::function<void(const env::FileStats*)> callback) {
 	logger.debug(u8"Reading stats of [", id, u8':', name, u8"]");
-	fHandleTask(str::u8::Build(u8"stats:", id, u8':', name), [this, callback](json::Reader<std::u8string_view> resp) {
-		if (resp.isNull())
+	fHandleTask(detail::TaskOpcode::stats, { id }, name.data(), name.size(), [this, callback](std::u8string_view resp) {
+		if (resp.empty())
 			callback(0);
 		else {
-			env::FileStats stats = fParseStats(resp.obj());
+			env::FileStats stats = fParseStats(resp, 0);
 			callback(&stats);
 		}
 		});
 }
 void env::FileSystem::readPath(uint64_t id, std::function<void(std::u8string_view)> callback) {
 	logger.debug(u8"Reading path of [", id, u8']');
-	fHandleTask(str::u8::Build(u8"path:", id), [this, callback](json::Reader<std::u8string_view> resp) {
-		if (resp.isNull())
-			callback(u8"");
-		else
-			callback(str::u8::Safe(resp.str()));
+	fHandleTask(detail::TaskOpcode::path, { id }, 0, 0, [callback](std::u8string_view resp) {
+		callback(resp);
 		});
 }
 void env::FileSystem::readDirectory(uint64_t id, std::function<void(const std::map<std::u8string, env::FileStats>*)> callback) {
 	logger.debug(u8"Reading directory of [", id, u8']');
-	fHandleTask(str::u8::Build(u8"list:", id), [this, callback](json::Reader<std::u8string_view> resp) {
-		if (resp.isNull()) {
+	fHandleTask(detail::TaskOpcode::list, { id }, 0, 0, [this, callback](std::u8string_view resp) {
+		if (resp.empty()) {
 			callback(0);
 			return;
 		}
 
-		/* parse all of the stats */
+		/* parse all of the stats (leading count ensures that empty directories are not mistaken for null) */
+		std::optional<uint64_t> count = fParseValue(resp.substr(0, std::min<size_t>(resp.size(), sizeof(uint64_t))));
+		resp = resp.substr(sizeof(uint64_t));
 		std::map<std::u8string, env::FileStats> out;
-		for (const auto& [key, value] : resp.obj()) {
-			/* skip duplicate keys */
-			std::u8string _key = str::u8::Safe(key);
-			if (out.contains(_key))
-				continue;
-
-			/* parse the value and add it to the output */
-			out[_key] = fParseStats(value.obj());
+		for (uint64_t i = 0; i < count.value(); ++i) {
+			/* parse the record and add it to the output (skip duplicate names) */
+			std::u8string name;
+			env::FileStats stats = fParseStats(resp, &name);
+			if (!out.contains(name))
+				out[name] = std::move(stats);
 		}
 		callback(&out);
 		});
 }
 void env::FileSystem::accessedObject(uint64_t id, std::function<void(bool)> callback) {
 	logger.debug(u8"Marking object [", id, u8"] as accessed");
-	fHandleTask(str::u8::Build(u8"accessed:", id), [this, callback](json::Reader<std::u8string_view> resp) {
-		callback(resp.boolean());
+	fHandleTask(detail::TaskOpcode::accessed, { id }, 0, 0, [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp).value_or(0) != 0);
 		});
 }
 void env::FileSystem::changedObject(uint64_t id, std::function<void(bool)> callback) {
 	logger.debug(u8"Marking object [", id, u8"] as changed");
-	fHandleTask(str::u8::Build(u8"changed:", id), [this, callback](json::Reader<std::u8string_view> resp) {
-		callback(resp.boolean());
+	fHandleTask(detail::TaskOpcode::changed, { id }, 0, 0, [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp).value_or(0) != 0);
 		});
 }
 void env::FileSystem::resizeFile(uint64_t id, uint64_t size, std::function<void(bool)> callback) {
 	logger.debug(u8"Resizing file [", id, u8"] to [", size, u8']');
-	fHandleTask(str::u8::Build(u8"resize:", id, u8':', size), [this, callback](json::Reader<std::u8string_view> resp) {
-		callback(resp.boolean());
+	fHandleTask(detail::TaskOpcode::resize, { id, size }, 0, 0, [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp).value_or(0) != 0);
 		});
 }
 void env::FileSystem::createFile(uint64_t id, std::u8string_view name, env::FileAccess access, std::function<void(std::optional<uint64_t>)> callback) {
 	logger.debug(u8"Creating file [", name, u8"] in [", id, u8']');
-	fHandleTask(str::u8::Build(u8"create:", id, u8':', access.owner, u8':', access.group, u8':', access.permissions.all, u8':', name), [this, callback](json::Reader<std::u8string_view> resp) {
-		if (resp.isNull())
-			callback(std::nullopt);
-		else
-			callback(resp.unum());
+	fHandleTask(detail::TaskOpcode::create, { id, access.owner, access.group, access.permissions.all }, name.data(), name.size(), [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp));
 		});
 }
 void env::FileSystem::readFile(uint64_t id, uint64_t offset, void* data, uint64_t size, std::function<void(std::optional<uint64_t>)> callback) {
 	logger.debug(u8"Reading file [", id, u8"] range [", str::As{ U"#010x", offset }, u8" - ", str::As{ U"#010x", (offset + size) }, u8']');
-	fHandleTask(str::u8::Build(u8"read:", id, u8":0x", data, u8':', str::As{ U"#x", offset }, u8':', str::As{ U"#x", size }), [callback](json::Reader<std::u8string_view> resp) {
-		if (resp.isNull())
-			callback(std::nullopt);
-		else
-			callback(resp.unum());
+	fHandleTask(detail::TaskOpcode::read, { id, offset }, data, size, [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp));
 		});
 }
 void env::FileSystem::writeFile(uint64_t id, uint64_t offset, const void* data, uint64_t size, std::function<void(std::optional<uint64_t>)> callback) {
 	logger.debug(u8"Writing file [", id, u8"] range [", str::As{ U"#010x", offset }, u8" - ", str::As{ U"#010x", (offset + size) }, u8']');
-	fHandleTask(str::u8::Build(u8"write:", id, u8":0x", data, u8':', str::As{ U"#x", offset }, u8':', str::As{ U"#x", size }), [callback](json::Reader<std::u8string_view> resp) {
-		if (resp.isNull())
-			callback(std::nullopt);
-		else
-			callback(resp.unum());
+	fHandleTask(detail::TaskOpcode::write, { id, offset }, data, size, [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp));
+		});
+}
+void env::FileSystem::readFileDirect(uint64_t id, uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<void(std::optional<uint64_t>)> callback) {
+	logger.debug(u8"Reading file [", id, u8"] from [", str::As{ U"#010x", offset }, u8"] into [", ranges.size(), u8"] physical ranges");
+	fHandleTask(detail::TaskOpcode::readPhysical, { id, offset }, ranges.data(), ranges.size() * sizeof(env::PhysicalRange), [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp));
+		});
+}
+void env::FileSystem::writeFileDirect(uint64_t id, uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<void(std::optional<uint64_t>)> callback) {
+	logger.debug(u8"Writing file [", id, u8"] from [", str::As{ U"#010x", offset }, u8"] out of [", ranges.size(), u8"] physical ranges");
+	fHandleTask(detail::TaskOpcode::writePhysical, { id, offset }, ranges.data(), ranges.size() * sizeof(env::PhysicalRange), [this, callback](std::u8string_view resp) {
+		callback(fParseValue(resp));
 		});
 }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../env-common.h"
+#include "../process/process-bridge.h"
 
 namespace env {
 	enum class FileType : uint8_t {
@@ -68,16 +69,23 @@ namespace env {
 	/* Note: all paths are expected to be fully qualified real absolute paths (symlinks will not be followed along the path)
 	*	Note: env::FileSystem will only ever produce file/directory/link */
 	class FileSystem {
+	private:
+		bool pInplace = false;
+
 	public:
 		FileSystem() = default;
 		FileSystem(env::FileSystem&&) = delete;
 		FileSystem(const env::FileSystem&) = delete;
 
 	private:
-		bool fHandleTask(const std::u8string& task, std::function<void(json::Reader<std::u8string_view>)> callback);
-		env::FileStats fParseStats(json::ObjReader<std::u8string_view> obj) const;
+		bool fHandleTask(detail::TaskOpcode opcode, std::initializer_list<uint64_t> args, const void* data, size_t size, std::function<void(std::u8string_view)> callback);
+		std::optional<uint64_t> fParseValue(std::u8string_view response) const;
+		env::FileStats fParseStats(std::u8string_view& response, std::u8string* name) const;
 
 	public:
+		/* check if the last task has been completed in-place (i.e. the callback was invoked before the task-function returned) */
+		bool completesInplace() const;
+
 		/* fetch stats for path (null if does not exist) */
 		void readStats(std::u8string_view path, std::function<void(const env::FileStats*)> callback);
 
@@ -107,5 +115,11 @@ namespace env {
 
 		/* write data to file (nullopt if not a file else number of bytes written - will not resize file) */
 		void writeFile(uint64_t id, uint64_t offset, const void* data, uint64_t size, std::function<void(std::optional<uint64_t>)> callback);
+
+		/* read data from file directly into the physical guest memory (nullopt if not a file else number of bytes read) */
+		void readFileDirect(uint64_t id, uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<void(std::optional<uint64_t>)> callback);
+
+		/* write data to file directly from the physical guest memory (nullopt if not a file else number of bytes written - will not resize file) */
+		void writeFileDirect(uint64_t id, uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<void(std::optional<uint64_t>)> callback);
 	};
 }
@@ -1,6 +1,7 @@
 /* SPDX-License-Identifier: BSD-3-Clause */
 /* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
 #include "env-memory.h"
+#include "../environment.h"
 
 static util::Logger logger{ u8"env::memory" };
 
@@ -33,15 +34,16 @@ env::detail::MemPhysIt env::Memory::fLookupPhysical(uint64_t address) const {
 env::detail::MemoryLookup env::Memory::fConstructLookup(detail::MemVirtIt virt, uint32_t usage) const {
 	detail::MemoryLookup lookup = detail::MemoryLookup{ virt->first, virt->second.physical, virt->second.size };
 
-	/* check if executable pages should not be considered */
-	bool skipExecutable = (pDetectExecuteWrite && (usage & env::Usage::Write) == env::Usage::Write);
+	/* check if executable pages or pages, which still need to be copied, should not be considered */
+	bool write = ((usage & env::Usage::Write) == env::Usage::Write);
+	bool skipExecutable = (pDetectExecuteWrite && write);
 
 	/* collect all previous contiguous regions of the same usage */
 	for (detail::MemVirtIt it = virt; it != pVirtual.begin();) {
 		--it;
 		if (fVirtEnd(it) != lookup.address || fPhysEnd(it) != lookup.physical || (it->second.usage & usage) != usage)
 			break;
-		if (skipExecutable && (it->second.usage & env::Usage::Execute) == env::Usage::Execute)
+		if ((skipExecutable && (it->second.usage & env::Usage::Execute) == env::Usage::Execute) || (write && it->second.copyOnWrite))
 			break;
 		lookup = { it->first, it->second.physical, it->second.size + lookup.size };
 	}
@@ -50,16 +52,27 @@ env::detail::MemoryLookup env::Memory::fConstructLookup(detail::MemVirtIt virt,
 	for (detail::MemVirtIt it = std::next(virt); it != pVirtual.end(); ++it) {
 		if (lookup.address + lookup.size != it->first || lookup.physical + lookup.size != it->second.physical || (it->second.usage & usage) != usage)
 			break;
-		if (skipExecutable && (it->second.usage & env::Usage::Execute) == env::Usage::Execute)
+		if ((skipExecutable && (it->second.usage & env::Usage::Execute) == env::Usage::Execute) || (write && it->second.copyOnWrite))
 			break;
 		lookup.size += it->second.size;
 	}
 	return lookup;
 }
-env::detail::MemoryLookup env::Memory::fFastLookup(env::guest_t access, uint32_t usage) const {
+env::detail::MemoryLookup env::Memory::fFastLookup(env::guest_t access, uint32_t usage) {
+	/* copy the accessed page, if it is written to for the first time since being cloned */
+	if ((usage & env::Usage::Write) == env::Usage::Write)
+		fCopyOnWrite(access, 1);
+
 	/* lookup the virtual mapping containing the corresponding accessed-address (must exist, as fast-lookup requires a previous checked lookup) */
 	env::detail::MemVirtIt virt = fLookupVirtual(access);
-	return fConstructLookup(virt, usage);
+	if (pLazy.empty())
+		return fConstructLookup(virt, usage);
+
+	/* populate the accessed chunk and ensure the lookup does not reach into unpopulated chunks */
+	fLoadLazy(access, 1);
+	detail::MemoryLookup lookup = fConstructLookup(virt, usage);
+	fClipLazy(lookup, access);
+	return lookup;
 }
 env::detail::MemoryLookup env::Memory::fCheckLookup(env::guest_t address, env::guest_t access, uint64_t size, uint32_t usage) {
 	/* lookup the virtual mapping containing the corresponding accessed-address */
@@ -88,10 +101,234 @@ env::detail::MemoryLookup env::Memory::fCheckLookup(env::guest_t address, env::g
 			pXInvalidated = true;
 	}
 
+	/* copy all accessed pages, which are written to for the first time since being cloned (may restructure the virtual mappings) */
+	if ((usage & env::Usage::Write) == env::Usage::Write && fCopyOnWrite(access, size))
+		virt = fLookupVirtual(access);
+
 	/* return the final contiguous lookup */
-	return fConstructLookup(virt, usage);
+	if (pLazy.empty())
+		return fConstructLookup(virt, usage);
+
+	/* populate all accessed chunks and ensure the lookup does not reach into unpopulated chunks */
+	fLoadLazy(access, std::max<uint64_t>(size, 1));
+	detail::MemoryLookup lookup = fConstructLookup(virt, usage);
+	fClipLazy(lookup, access);
+	return lookup;
+}
+
+void env::Memory::fLoadLazyChunk(env::guest_t address, const detail::MemoryLazy& lazy) const {
+	logger.fmtTrace(u8"Populating [{:#018x}] with size [{:#010x}] from file [{}] at [{:#010x}]", address, lazy.size, lazy.id, lazy.offset);
+
+	/* collect the physical ranges backing the chunk (always fully mapped, as chunks are dropped when unmapped) */
+	std::vector<env::PhysicalRange> ranges;
+	for (detail::MemVirtIt virt = fLookupVirtual(address); virt != pVirtual.end() && virt->first < address + lazy.size; ++virt) {
+		env::guest_t begin = std::max<env::guest_t>(virt->first, address);
+		uint64_t count = std::min<env::guest_t>(fVirtEnd(virt), address + lazy.size) - begin;
+		uint64_t physical = virt->second.physical + (begin - virt->first);
+		if (!ranges.empty() && ranges.back().physical + ranges.back().size == physical)
+			ranges.back().size += count;
+		else
+			ranges.push_back(env::PhysicalRange{ physical, count });
+	}
+
+	/* read the data straight into the physical memory (must complete in-place, as the accessing operation cannot be suspended) */
+	std::shared_ptr<bool> completed = std::make_shared<bool>(false);
+	env::Instance()->filesystem().readFileDirect(lazy.id, lazy.offset, ranges, [completed, address](std::optional<uint64_t> count) {
+		*completed = true;
+		if (!count.has_value())
+			logger.warn(u8"Failed to populate lazily mapped file at [", str::As{ U"#018x", address }, u8']');
+		});
+	if (!*completed)
+		logger.fatal(u8"Lazily mapped file at [", str::As{ U"#018x", address }, u8"] could not be populated in-place");
+}
+void env::Memory::fLoadLazy(env::guest_t address, uint64_t size) const {
+	/* lookup the first chunk, which overlaps the range */
+	detail::MemLazyIt it = pLazy.upper_bound(address);
+	if (it != pLazy.begin() && std::prev(it)->first + std::prev(it)->second.size > address)
+		--it;
+
+	/* populate all overlapping chunks (removed before being populated, as they are considered populated from there on) */
+	while (it != pLazy.end() && it->first < address + size) {
+		std::pair<env::guest_t, detail::MemoryLazy> chunk = *it;
+		it = pLazy.erase(it);
+		fLoadLazyChunk(chunk.first, chunk.second);
+	}
+}
+void env::Memory::fClipLazy(detail::MemoryLookup& lookup, env::guest_t access) const {
+	/* restrict the lookup to the range around the access, which does not contain any unpopulated
+	*	chunks (the accessed chunk itself must already be populated) to ensure it is not cached */
+	detail::MemLazyIt next = pLazy.upper_bound(access);
+	if (next != pLazy.end() && next->first < lookup.address + lookup.size)
+		lookup.size = next->first - lookup.address;
+	if (next == pLazy.begin())
+		return;
+
+	/* clip the lower end to the end of the previous chunk */
+	env::guest_t end = std::prev(next)->first + std::prev(next)->second.size;
+	if (end <= lookup.address)
+		return;
+	uint64_t skip = end - lookup.address;
+	lookup.address += skip;
+	lookup.physical += skip;
+	lookup.size -= skip;
+}
+void env::Memory::fSplitLazy(env::guest_t address, uint64_t size) {
+	/* populate the chunk, which only partially overlaps the start of the range */
+	detail::MemLazyIt it = pLazy.upper_bound(address);
+	if (it != pLazy.begin() && std::prev(it)->first < address && std::prev(it)->first + std::prev(it)->second.size > address)
+		fLoadLazy(address, 1);
+
+	/* populate the chunk, which only partially overlaps the end of the range */
+	env::guest_t end = address + size;
+	it = pLazy.upper_bound(end - 1);
+	if (it != pLazy.begin() && std::prev(it)->first + std::prev(it)->second.size > end)
+		fLoadLazy(end - 1, 1);
+}
+
+void env::Memory::fReleasePhysical(uint64_t physical, uint64_t size) {
+	detail::MemPhysIt phys = fLookupPhysical(physical);
+	uint64_t end = physical + size;
+
+	/* break the physical memory at the lower and upper edge and mark it as used one time less */
+	while (physical < end) {
+		if (phys->first < physical)
+			phys = fPhysSplit(phys, physical);
+		if (end < fPhysEnd(phys))
+			fPhysSplit(phys, end);
+		physical = fPhysEnd(phys);
+		--phys->second.users;
+		phys = std::next(fPhysMerge(phys));
+	}
+}
+bool env::Memory::fPrivatize(detail::MemVirtIt virt) {
+	uint64_t physical = virt->second.physical, size = virt->second.size;
+	virt->second.copyOnWrite = false;
+
+	/* check if the physical memory is still shared (otherwise only the marker needs to be removed) */
+	bool shared = false;
+	for (detail::MemPhysIt phys = fLookupPhysical(physical); phys != pPhysical.end() && phys->first < physical + size; ++phys)
+		shared = (shared || phys->second.users > 1);
+	if (!shared)
+		return false;
+	logger.fmtTrace(u8"Copying [{:#018x}] with size [{:#010x}] upon write", virt->first, size);
+
+	/* allocate the private physical memory and copy the content over */
+	detail::MemPhysIt phys = fMemAllocatePhysical(size, size);
+	if (phys == pPhysical.end())
+		logger.fatal(u8"Failed to allocate memory to copy [", str::As{ U"#018x", virt->first }, u8"] upon write");
+	if (phys->second.size > size)
+		fPhysSplit(phys, phys->first + size);
+	uint64_t copy = phys->first;
+	phys->second.users = 1;
+	fPhysMerge(phys);
+	fMovePhysical(copy, physical, size);
+
+	/* release the shared physical memory (remains used by the other ranges) and remap the range onto the copy */
+	fReleasePhysical(physical, size);
+	virt->second.physical = copy;
+	return true;
+}
+bool env::Memory::fCopyOnWrite(env::guest_t address, uint64_t size) {
+	uint64_t chunk = std::max<uint64_t>(detail::CopyChunkSize, pPageSize);
+	env::guest_t end = address + std::max<uint64_t>(size, 1);
+	bool modified = false, copied = false;
+
+	/* lookup the first virtual mapping, which overlaps the range */
+	detail::MemVirtIt virt = pVirtual.upper_bound(address);
+	if (virt != pVirtual.begin() && fVirtEnd(std::prev(virt)) > address)
+		--virt;
+
+	/* copy all chunks around the range, which are marked to be copied upon writes */
+	for (; virt != pVirtual.end() && virt->first < end; ++virt) {
+		if (!virt->second.copyOnWrite)
+			continue;
+		modified = true;
+
+		/* break the virtual memory at the chunk boundaries around the range */
+		env::guest_t first = std::max<env::guest_t>(virt->first, address & ~(chunk - 1));
+		env::guest_t last = std::min<env::guest_t>(fVirtEnd(virt), ((end - 1) & ~(chunk - 1)) + chunk);
+		if (first > virt->first)
+			virt = fVirtSplit(virt, first);
+		if (last < fVirtEnd(virt))
+			fVirtSplit(virt, last);
+
+		/* copy the physical memory, if it is still shared, and merge the range with its neighbors */
+		copied = (fPrivatize(virt) || copied);
+		if (detail::MemVirtIt next = std::next(virt); next != pVirtual.end())
+			fVirtMergePrev(next);
+		virt = fVirtMergePrev(virt);
+	}
+
+	/* flush the caches to ensure no cached lookup references the shared physical memory anymore */
+	if (copied)
+		fFlushCaches();
+	return modified;
 }
+bool env::Memory::fShare(env::guest_t address, env::guest_t source, uint64_t size) {
+	logger.fmtDebug(u8"Sharing [{:#018x}] with size [{:#010x}] at [{:#018x}]", source, size, address);
+
+	/* check if the addresses and size are aligned properly */
+	if (fPageOffset(address) != 0 || fPageOffset(source) != 0 || fPageOffset(size) != 0 || size == 0) {
+		logger.error(u8"Sharing requires addresses and size to be page-aligned and size greater than zero");
+		return false;
+	}
+	if (address + size < address || source + size < source) {
+		logger.error(u8"Size overflows for operation");
+		return false;
+	}
+
+	/* ensure that the destination does not overlap existing mappings */
+	detail::MemVirtIt next = pVirtual.upper_bound(address);
+	detail::MemVirtIt prev = (next == pVirtual.begin() ? pVirtual.end() : std::prev(next));
+	if ((next != pVirtual.end() && next->first - address < size) || (prev != pVirtual.end() && fVirtEnd(prev) > address)) {
+		logger.error(u8"Sharing range is already partially mapped");
+		return false;
+	}
+
+	/* collect the source ranges and ensure that they are fully mapped */
+	std::vector<std::pair<env::guest_t, detail::MemoryVirtual>> ranges;
+	detail::MemVirtIt virt = fLookupVirtual(source);
+	for (env::guest_t current = source; current < source + size; ++virt) {
+		if (virt == pVirtual.end() || virt->first > current) {
+			logger.error(u8"Sharing source is not fully mapped");
+			return false;
+		}
+		uint64_t count = std::min<env::guest_t>(fVirtEnd(virt), source + size) - current;
+		ranges.push_back({ address + (current - source), detail::MemoryVirtual{ virt->second.physical + (current - virt->first), count, virt->second.usage, virt->second.copyOnWrite } });
+		current += count;
+	}
+
+	/* insert the virtual ranges and mark their physical ranges as used once more */
+	for (const auto& [start, range] : ranges) {
+		detail::MemPhysIt phys = fLookupPhysical(range.physical);
+		uint64_t phAddress = range.physical, phEnd = range.physical + range.size;
+		while (phAddress < phEnd) {
+			/* break the physical memory at the lower and upper edge and merge it with equally used neighbors */
+			if (phys->first < phAddress)
+				phys = fPhysSplit(phys, phAddress);
+			if (phEnd < fPhysEnd(phys))
+				fPhysSplit(phys, phEnd);
+			phAddress = fPhysEnd(phys);
+			++phys->second.users;
+			phys = std::next(fPhysMerge(phys));
+		}
+		fVirtMergePrev(pVirtual.insert({ start, range }).first);
+	}
+	if (detail::MemVirtIt after = pVirtual.find(address + size); after != pVirtual.end())
+		fVirtMergePrev(after);
+
+	/* share the unpopulated chunks of the source (partially shared chunks are populated first) */
+	if (!pLazy.empty()) {
+		fSplitLazy(source, size);
+		std::vector<std::pair<env::guest_t, detail::MemoryLazy>> chunks{ pLazy.lower_bound(source), pLazy.lower_bound(source + size) };
+		for (const auto& [start, lazy] : chunks)
+			pLazy[address + (start - source)] = lazy;
+	}
 
+	/* flush the caches to ensure the new mapping is accepted */
+	fFlushCaches();
+	return true;
+}
 uint64_t env::Memory::fPageOffset(env::guest_t address) const {
 	return (address & (pPageSize - 1));
 }
@@ -147,9 +384,10 @@ void env::Memory::fCheckConsistency() const {
 		physAddress += phys.size;
 	}
 
-	/* neighboring virtual slots must always be merged if usage is identical and must be non-empty */
-	uint64_t totalVirtUsed = 0, virtAddress = 0;
+	/* neighboring virtual slots must always be merged if usage is identical and physically contiguous and must be non-empty */
+	uint64_t totalVirtUsed = 0, virtAddress = 0, virtPhysical = 0;
 	uint32_t virtLastUsage = 0;
+	bool virtLastCopy = false;
 	for (const auto& [address, virt] : pVirtual) {
 		detail::MemPhysIt phys = fLookupPhysical(virt.physical);
 
@@ -171,14 +409,16 @@ void env::Memory::fCheckConsistency() const {
 		/* validate the slot itself */
 		if (virt.size == 0 || fPageOffset(virt.size) != 0)
 			logger.fatal(u8"Virtual slot [", str::As{ U"#018x", address }, u8"] size is invalid");
-		if (totalVirtUsed > 0 && virtLastUsage == virt.usage && virtAddress == address)
+		if (totalVirtUsed > 0 && virtLastUsage == virt.usage && virtLastCopy == virt.copyOnWrite && virtAddress == address && virtPhysical == virt.physical)
 			logger.fatal(u8"Virtual slot [", str::As{ U"#018x", address }, u8"] usage is invalid");
 		if (virtAddress > address)
 			logger.fatal(u8"Virtual slot [", str::As{ U"#018x", address }, u8"] address is invalid");
 
 		virtAddress = address + virt.size;
+		virtPhysical = virt.physical + virt.size;
 		totalVirtUsed += virt.size;
 		virtLastUsage = virt.usage;
+		virtLastCopy = virt.copyOnWrite;
 	}
 
 	if (totalPhysUsed != totalVirtUsed)
@@ -226,7 +466,7 @@ env::detail::MemVirtIt env::Memory::fVirtSplit(detail::MemVirtIt virt, env::gues
 	uint64_t size = (address - virt->first);
 
 	/* insert the new next block */
-	detail::MemVirtIt next = pVirtual.insert(std::next(virt), { address, detail::MemoryVirtual{ virt->second.physical + size, virt->second.size - size, virt->second.usage } });
+	detail::MemVirtIt next = pVirtual.insert(std::next(virt), { address, detail::MemoryVirtual{ virt->second.physical + size, virt->second.size - size, virt->second.usage, virt->second.copyOnWrite } });
 
 	/* reduce the size of the current block */
 	virt->second.size = size;
@@ -238,7 +478,7 @@ env::detail::MemVirtIt env::Memory::fVirtMergePrev(detail::MemVirtIt virt) {
 
 	/* check if the current entry can be removed */
 	detail::MemVirtIt prev = std::prev(virt);
-	if (fVirtEnd(prev) != virt->first || prev->second.usage != virt->second.usage)
+	if (fVirtEnd(prev) != virt->first || prev->second.usage != virt->second.usage || prev->second.copyOnWrite != virt->second.copyOnWrite)
 		return virt;
 	if (fPhysEnd(prev) != virt->second.physical)
 		return virt;
@@ -682,8 +922,21 @@ uint32_t env::Memory::getUsage(env::guest_t address) const {
 		return virt->second.usage;
 	return 0;
 }
+bool env::Memory::isShared(env::guest_t address, env::guest_t source, uint64_t size) const {
+	/* walk both ranges in parallel and compare their physical memory and usages */
+	for (uint64_t offset = 0; offset < size;) {
+		detail::MemVirtIt first = fLookupVirtual(address + offset), second = fLookupVirtual(source + offset);
+		if (first == pVirtual.end() || second == pVirtual.end())
+			return false;
+		uint64_t skipFirst = (address + offset - first->first), skipSecond = (source + offset - second->first);
+		if (first->second.physical + skipFirst != second->second.physical + skipSecond || first->second.usage != second->second.usage)
+			return false;
+		offset += std::min<uint64_t>(first->second.size - skipFirst, second->second.size - skipSecond);
+	}
+	return true;
+}
 
-env::guest_t env::Memory::alloc(uint64_t size, uint32_t usage) {
+env::guest_t env::Memory::fAllocAddress(uint64_t size) const {
 	/* check if the allocation can be serviced */
 	if (size > detail::EndOfAllocations - detail::StartOfAllocations)
 		return 0;
@@ -746,9 +999,14 @@ env::guest_t env::Memory::alloc(uint64_t size, uint32_t usage) {
 		}
 	}
 
-	/* align the final address and try to perform the allocation */
-	address &= ~(pPageSize - 1);
-	if (!fMMap(address, size, usage))
+	/* align the final address */
+	return (address & ~(pPageSize - 1));
+}
+
+env::guest_t env::Memory::alloc(uint64_t size, uint32_t usage) {
+	/* lookup the address and try to perform the allocation */
+	env::guest_t address = fAllocAddress(size);
+	if (address == 0 || !fMMap(address, size, usage))
 		return 0;
 	return address;
 }
@@ -790,6 +1048,12 @@ bool env::Memory::munmap(env::guest_t address, uint64_t size) {
 		return false;
 	}
 
+	/* drop all unpopulated chunks of the range (partially unmapped chunks are populated first) */
+	if (!pLazy.empty()) {
+		fSplitLazy(address, size);
+		pLazy.erase(pLazy.lower_bound(address), pLazy.lower_bound(endAddress));
+	}
+
 	/* break the first and last virtual memory at the boundaries */
 	if (address > begin->first) {
 		detail::MemVirtIt temp = fVirtSplit(begin, address);
@@ -934,6 +1198,10 @@ void env::Memory::mwrite(env::guest_t dest, const void* source, uint64_t size, u
 		return;
 	const uint8_t* ptr = static_cast<const uint8_t*>(source);
 
+	/* copy the cloned pages also for writes without the write-usage, as they are not copied by the lookups */
+	if ((usage & env::Usage::Write) != env::Usage::Write)
+		fCopyOnWrite(dest, size);
+
 	/* lookup the address to ensure it is mapped and perform the write operations */
 	detail::MemoryLookup lookup = fCheckLookup(detail::MainAccessAddress, dest, size, usage);
 	while (true) {
@@ -955,6 +1223,10 @@ void env::Memory::mclear(env::guest_t dest, uint64_t size, uint32_t usage) {
 	if (size == 0)
 		return;
 
+	/* copy the cloned pages also for clears without the write-usage, as they are not copied by the lookups */
+	if ((usage & env::Usage::Write) != env::Usage::Write)
+		fCopyOnWrite(dest, size);
+
 	/* lookup the address to ensure it is mapped and perform the clear operations */
 	detail::MemoryLookup lookup = fCheckLookup(detail::MainAccessAddress, dest, size, usage);
 	while (true) {
@@ -970,3 +1242,85 @@ void env::Memory::mclear(env::guest_t dest, uint64_t size, uint32_t usage) {
 		lookup = fFastLookup(dest, usage);
 	}
 }
+void env::Memory::mresolve(std::vector<env::PhysicalRange>& ranges, env::guest_t address, uint64_t size, uint32_t usage) {
+	logger.fmtTrace(u8"Resolving [{:#018x}] with size [{:#010x}] and usage [{}]", address, size, env::Usage::Print{ usage });
+	if (size == 0)
+		return;
+
+	/* lookup the address to ensure it is mapped and collect the physical ranges */
+	detail::MemoryLookup lookup = fCheckLookup(detail::MainAccessAddress, address, size, usage);
+	while (true) {
+		uint64_t offset = (address - lookup.address);
+		uint64_t count = std::min<uint64_t>(lookup.size - offset, size);
+		if (!ranges.empty() && ranges.back().physical + ranges.back().size == lookup.physical + offset)
+			ranges.back().size += count;
+		else
+			ranges.push_back(env::PhysicalRange{ lookup.physical + offset, count });
+
+		/* check if the end has been reached and otherwise advance the parameter */
+		if (count >= size)
+			return;
+		address += count;
+		size -= count;
+		lookup = fFastLookup(address, usage);
+	}
+}
+void env::Memory::mlazy(env::guest_t address, uint64_t size, uint64_t id, uint64_t offset) {
+	logger.fmtDebug(u8"Lazily mapping [{:#018x}] with size [{:#010x}] from file [{}] at [{:#010x}]", address, size, id, offset);
+
+	/* split the range into chunks, which are populated individually (range must already be mapped and is considered to be cleared) */
+	uint64_t chunk = std::max<uint64_t>(detail::LazyChunkSize, pPageSize);
+	for (uint64_t i = 0; i < size; i += chunk)
+		pLazy[address + i] = detail::MemoryLazy{ std::min<uint64_t>(chunk, size - i), id, offset + i };
+
+	/* flush the caches to ensure that no cached lookup reaches into the chunks */
+	fFlushCaches();
+}
+bool env::Memory::mshare(env::guest_t address, env::guest_t source, uint64_t size) {
+	/* copy the cloned pages of the source, as the sharing must observe all writes to either range */
+	fCopyOnWrite(source, size);
+	return fShare(address, source, size);
+}
+env::guest_t env::Memory::allocShared(env::guest_t source, uint64_t size) {
+	/* lookup the address and try to share the source into it */
+	env::guest_t address = fAllocAddress(size);
+	if (address == 0 || !mshare(address, source, size))
+		return 0;
+	return address;
+}
+bool env::Memory::mclone(env::guest_t address, env::guest_t source, uint64_t size) {
+	logger.fmtDebug(u8"Cloning [{:#018x}] with size [{:#010x}] at [{:#018x}]", source, size, address);
+
+	/* check if the source and size are aligned properly (the destination is validated by the sharing) */
+	if (fPageOffset(source) != 0 || fPageOffset(size) != 0 || size == 0 || source + size < source) {
+		logger.error(u8"Cloning requires the source and size to be page-aligned and size greater than zero");
+		return false;
+	}
+
+	/* mark the pages of the source, which are not yet shared, to be copied upon their next write */
+	for (env::guest_t current = source; current < source + size;) {
+		detail::MemVirtIt virt = fLookupVirtual(current);
+		if (virt == pVirtual.end()) {
+			logger.error(u8"Cloning source is not fully mapped");
+			return false;
+		}
+		uint64_t physical = virt->second.physical + (current - virt->first);
+		detail::MemPhysIt phys = fLookupPhysical(physical);
+		env::guest_t next = std::min<env::guest_t>({ fVirtEnd(virt), source + size, current + (fPhysEnd(phys) - physical) });
+
+		/* break the virtual memory at the edges of the private physical memory */
+		if (phys->second.users == 1 && !virt->second.copyOnWrite) {
+			if (current > virt->first)
+				virt = fVirtSplit(virt, current);
+			if (next < fVirtEnd(virt))
+				fVirtSplit(virt, next);
+			virt->second.copyOnWrite = true;
+		}
+		current = next;
+	}
+	for (detail::MemVirtIt virt = fLookupVirtual(source); virt != pVirtual.end() && virt->first <= source + size;)
+		virt = std::next(fVirtMergePrev(virt));
+
+	/* share the source into the destination (which inherits the markers) */
+	return fShare(address, source, size);
+}
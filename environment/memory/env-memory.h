@@ -21,6 +21,12 @@ namespace env {
 		static constexpr env::guest_t EndOfAllocations = 0x0800'0000'0000'0000;
 		static constexpr env::guest_t SpacingBetweenAllocations = 0x8'0000'0000;
 
+		/* granularity in which lazily mapped files are populated (rounded up to the page-size) */
+		static constexpr uint64_t LazyChunkSize = 0x10000;
+
+		/* granularity in which cloned ranges are copied upon their first write (rounded up to the page-size) */
+		static constexpr uint64_t CopyChunkSize = 0x10000;
+
 		struct MemoryCache {
 			env::guest_t address{ 0 };
 			uint32_t physical{ 0 };
@@ -38,11 +44,17 @@ namespace env {
 			uint64_t physical = 0;
 			uint64_t size = 0;
 			uint32_t usage = 0;
+			bool copyOnWrite = false;
 		};
 		struct MemoryPhysical {
 			uint64_t size = 0;
 			uint64_t users = 0;
 		};
+		struct MemoryLazy {
+			uint64_t size = 0;
+			uint64_t id = 0;
+			uint64_t offset = 0;
+		};
 		struct MemoryFast {
 			env::guest_t address{ 0 };
 			uint32_t physical{ 0 };
@@ -52,6 +64,7 @@ namespace env {
 
 		using MemVirtIt = std::map<env::guest_t, detail::MemoryVirtual>::iterator;
 		using MemPhysIt = std::map<uint64_t, detail::MemoryPhysical>::iterator;
+		using MemLazyIt = std::map<env::guest_t, detail::MemoryLazy>::iterator;
 
 		static constexpr uint32_t MemoryFastCacheBits = 8;
 		static constexpr uint32_t MemoryFastCount = (1 << detail::MemoryFastCacheBits);
@@ -68,6 +81,7 @@ namespace env {
 		mutable std::vector<detail::MemoryCache> pCaches;
 		mutable std::map<env::guest_t, detail::MemoryVirtual> pVirtual;
 		mutable std::map<uint64_t, detail::MemoryPhysical> pPhysical;
+		mutable std::map<env::guest_t, detail::MemoryLazy> pLazy;
 		uint64_t pPageSize = 0;
 		uint64_t pPageBitShift = 0;
 		uint32_t pCacheCount = 0;
@@ -86,9 +100,21 @@ namespace env {
 		detail::MemVirtIt fLookupVirtual(env::guest_t address) const;
 		detail::MemPhysIt fLookupPhysical(uint64_t address) const;
 		detail::MemoryLookup fConstructLookup(detail::MemVirtIt virt, uint32_t usage) const;
-		detail::MemoryLookup fFastLookup(env::guest_t access, uint32_t usage) const;
+		detail::MemoryLookup fFastLookup(env::guest_t access, uint32_t usage);
 		detail::MemoryLookup fCheckLookup(env::guest_t address, env::guest_t access, uint64_t size, uint32_t usage);
 
+	private:
+		void fLoadLazyChunk(env::guest_t address, const detail::MemoryLazy& lazy) const;
+		void fLoadLazy(env::guest_t address, uint64_t size) const;
+		void fClipLazy(detail::MemoryLookup& lookup, env::guest_t access) const;
+		void fSplitLazy(env::guest_t address, uint64_t size);
+
+	private:
+		void fReleasePhysical(uint64_t physical, uint64_t size);
+		bool fPrivatize(detail::MemVirtIt virt);
+		bool fCopyOnWrite(env::guest_t address, uint64_t size);
+		bool fShare(env::guest_t address, env::guest_t source, uint64_t size);
+
 	private:
 		uint64_t fPageOffset(env::guest_t address) const;
 		uint64_t fExpandPhysical(uint64_t size, uint64_t growth) const;
@@ -114,6 +140,7 @@ namespace env {
 		uint64_t fMemMergePhysical(detail::MemVirtIt virt, detail::MemPhysIt phys, uint64_t size, detail::MemPhysIt physPrev, detail::MemPhysIt physNext);
 		void fReducePhysical();
 		bool fMMap(env::guest_t address, uint64_t size, uint32_t usage);
+		env::guest_t fAllocAddress(uint64_t size) const;
 
 	private:
 		void fCheckXInvalidated(env::guest_t address);
@@ -130,6 +157,9 @@ namespace env {
 		std::pair<env::guest_t, uint64_t> findNext(env::guest_t address) const;
 		uint32_t getUsage(env::guest_t address) const;
 
+		/* check if both ranges are fully mapped onto the same physical memory with the same usages */
+		bool isShared(env::guest_t address, env::guest_t source, uint64_t size) const;
+
 	public:
 		env::guest_t alloc(uint64_t size, uint32_t usage);
 		bool mmap(env::guest_t address, uint64_t size, uint32_t usage);
@@ -139,6 +169,21 @@ namespace env {
 		void mwrite(env::guest_t dest, const void* source, uint64_t size, uint32_t usage);
 		void mclear(env::guest_t dest, uint64_t size, uint32_t usage);
 
+		/* populate the already mapped range lazily from the file upon first access (only valid while file-tasks are completed in-place) */
+		void mlazy(env::guest_t address, uint64_t size, uint64_t id, uint64_t offset);
+
+		/* map the range onto the physical memory of the mapped source-range with the same usages (physical memory is shared, until unmapped,
+		*	and pending copies of cloned source pages are performed beforehand) */
+		bool mshare(env::guest_t address, env::guest_t source, uint64_t size);
+		env::guest_t allocShared(env::guest_t source, uint64_t size);
+
+		/* map the range onto the physical memory of the mapped source-range like mshare, but copy the pages, which are not yet
+		*	shared, upon the first write to either range (already shared pages remain shared between both ranges) */
+		bool mclone(env::guest_t address, env::guest_t source, uint64_t size);
+
+		/* append the physical ranges backing the guest range to the list (contiguous ranges are merged) */
+		void mresolve(std::vector<env::PhysicalRange>& ranges, env::guest_t address, uint64_t size, uint32_t usage);
+
 	public:
 		template <class Type>
 		Type read(env::guest_t address) const {
@@ -31,6 +31,8 @@ bool env::SetInstance(std::unique_ptr<env::System>&& system, uint32_t pageSize,
 	return false;
 }
 void env::ClearInstance() {
+	/* ensure that no terminal output of the process is lost */
+	host::FlushOut();
 	logger.log(u8"Destroying process with id [", global::ProcId, u8"]...");
 
 	/* reset all mapped core-functions and release the current instance */
@@ -86,18 +88,17 @@ void env::Process::fAddBinding(const std::u8string& mod, const std::u8string& na
 		logger.fatal(u8"Cannot bind object [", name, u8"] as export after the core has started loading");
 	pBindings[mod].push_back({ name, 0 });
 }
-bool env::Process::fHandleTask(const std::u8string& task, std::function<void(std::u8string_view, bool)> callback) {
+bool env::Process::fStartTask(std::function<void(uint32_t)> dispatch, std::function<void(std::u8string_view, bool)> callback) {
 	/* check if a task is currently active, in which case no other task can be processed */
 	if (pTaskState != TaskState::none)
 		logger.fatal(u8"Can only process one task at a time");
 	size_t stamp = ++pTaskStamp;
 	uint32_t procId = global::ProcId;
-	logger.debug(u8"Handling task [", task, u8"] for [", global::ProcId, u8"] with stamp [", stamp, u8"]...");
 
 	/* setup the task and pass it out (can be handled in-place, in which case the callback will be called immediately again) */
 	pTaskState = TaskState::started;
 	pTaskCallback = callback;
-	detail::ProcessBridge::HandleTask(task, global::ProcId);
+	dispatch(global::ProcId);
 
 	/* check if the task has been executed inplace (note: it could also have destroyed the process itself) */
 	if (global::Instance.get() == 0 || procId != global::ProcId)
@@ -107,6 +108,18 @@ bool env::Process::fHandleTask(const std::u8string& task, std::function<void(std
 	pTaskState = TaskState::awaiting;
 	return false;
 }
+bool env::Process::fHandleTask(const std::u8string& task, std::function<void(std::u8string_view, bool)> callback) {
+	logger.debug(u8"Handling task [", task, u8"] for [", global::ProcId, u8"] with stamp [", pTaskStamp + 1, u8"]...");
+	return fStartTask([&task](uint32_t process) {
+		detail::ProcessBridge::HandleTask(task, process);
+		}, callback);
+}
+bool env::Process::fHandleTask(const detail::TaskRequest& request, std::function<void(std::u8string_view, bool)> callback) {
+	logger.debug(u8"Handling binary task [", str::As{ U"#04x", request.opcode }, u8"] for [", global::ProcId, u8"] with stamp [", pTaskStamp + 1, u8"]...");
+	return fStartTask([&request](uint32_t process) {
+		detail::ProcessBridge::HandleBinaryTask(request, process);
+		}, callback);
+}
 bool env::Process::fTaskCompleted(uint32_t process, std::u8string_view response) {
 	/* check if the ids still match and otherwise simply discard the call (will not affect any internal states) */
 	if (process != global::ProcId)
@@ -140,9 +153,16 @@ bool env::Process::fLoadCore() {
 		return false;
 	}
 
-	/* setup the core loading task */
+	/* setup the core loading task and compute the identity of the environment (FNV-1a of the core and the
+	*	host-addresses referenced by blocks, used to identify if blocks can be reused across processes) */
 	const std::vector<uint8_t>& data = binOutput.output();
-	fHandleTask(str::u8::Build(u8"core:0x", static_cast<const void*>(data.data()), u8':', str::As{ U"#x", data.size() }), [this](std::u8string_view, bool) {
+	pBlockIdentity = 0xcbf2'9ce4'8422'2325;
+	for (uint8_t byte : data)
+		pBlockIdentity = (pBlockIdentity ^ byte) * 0x0000'0100'0000'01b3;
+	pBlockIdentity = (pBlockIdentity ^ uint64_t(detail::ContextAccess::ContextAddress())) * 0x0000'0100'0000'01b3;
+	pBlockIdentity = (pBlockIdentity ^ uint64_t(detail::MemoryAccess::CacheAddress())) * 0x0000'0100'0000'01b3;
+	detail::TaskRequest request{ .opcode = uint32_t(detail::TaskOpcode::loadCore), .size = uint32_t(data.size()), .data = uint64_t(uintptr_t(data.data())) };
+	fHandleTask(request, [this](std::u8string_view, bool) {
 		fCoreLoaded();
 		});
 
@@ -192,22 +212,33 @@ void env::Process::fLoadBlock() {
 		logger.fatal(u8"Cannot load a block while another load is in progress");
 	pProcState = ProcState::loadingBlock;
 
-	try {
-		/* setup the writer to either produce only the binary output, or the binary and text output */
-		std::unique_ptr<wasm::TextWriter> tWriter = (pLogBlocks ? std::make_unique<wasm::TextWriter>(u8"  ") : 0);
-		wasm::SplitWriter writer = wasm::SplitWriter{ &binOutput, tWriter.get() };
-
-		/* setup the block module to be loaded */
-		wasm::Module mod{ &writer };
-		pExports = pSystem->setupBlock(mod);
-		mod.close();
-
-		/* check if the text-output should be logged */
-		if (pLogBlocks)
-			logger.trace('\n', tWriter->output());
+	/* check if a previously produced module can be reused for the block (copied, as the system may release it) */
+	std::vector<uint8_t> warmData;
+	if (const env::WarmBlock* warm = pSystem->warmBlock(); warm != 0) {
+		warmData = warm->data;
+		pExports = warm->exports;
 	}
-	catch (const wasm::Exception& e) {
-		logger.fatal(u8"WASM exception occurred while creating the block module: ", e.what());
+	else {
+		try {
+			/* setup the writer to either produce only the binary output, or the binary and text output */
+			std::unique_ptr<wasm::TextWriter> tWriter = (pLogBlocks ? std::make_unique<wasm::TextWriter>(u8"  ") : 0);
+			wasm::SplitWriter writer = wasm::SplitWriter{ &binOutput, tWriter.get() };
+
+			/* setup the block module to be loaded */
+			wasm::Module mod{ &writer };
+			pExports = pSystem->setupBlock(mod);
+			mod.close();
+
+			/* check if the text-output should be logged */
+			if (pLogBlocks)
+				logger.trace('\n', tWriter->output());
+
+			/* notify the system about the produced module */
+			pSystem->blockProduced(binOutput.output(), pExports);
+		}
+		catch (const wasm::Exception& e) {
+			logger.fatal(u8"WASM exception occurred while creating the block module: ", e.what());
+		}
 	}
 
 	/* check if the exports are valid */
@@ -223,8 +254,9 @@ void env::Process::fLoadBlock() {
 	detail::ProcessBridge::BlockImportsCommit(false);
 
 	/* setup the block loading task */
-	const std::vector<uint8_t>& data = binOutput.output();
-	fHandleTask(str::u8::Build(u8"block:0x", static_cast<const void*>(data.data()), u8':', str::As{ U"#x", data.size() }), [this](std::u8string_view, bool) {
+	const std::vector<uint8_t>& data = (warmData.empty() ? binOutput.output() : warmData);
+	detail::TaskRequest request{ .opcode = uint32_t(detail::TaskOpcode::loadBlock), .size = uint32_t(data.size()), .data = uint64_t(uintptr_t(data.data())) };
+	fHandleTask(request, [this](std::u8string_view, bool) {
 		fBlockLoaded();
 		});
 
@@ -291,6 +323,9 @@ env::Interact& env::Process::interact() {
 uint64_t env::Process::startTimeUS() const {
 	return pStartTimeUS;
 }
+uint64_t env::Process::blockIdentity() const {
+	return pBlockIdentity;
+}
 uint32_t env::Process::pageSize() const {
 	return pPageSize;
 }
@@ -42,7 +42,7 @@ namespace env {
 		env::FileSystem pFileSystem;
 		env::Mapping pMapping;
 		env::Interact pInteract;
-		std::u8string pBlockImportName;
+		std::u8string pBlockImportName = u8"sys";
 		size_t pTaskStamp = 0;
 		uint32_t pPageSize = 0;
 		uint32_t pMemoryCaches = 0;
@@ -50,6 +50,7 @@ namespace env {
 		uint64_t pPhysicalPages = 0;
 		uint64_t pMemoryPages = 0;
 		uint64_t pStartTimeUS = 0;
+		uint64_t pBlockIdentity = 0;
 		ProcState pProcState = ProcState::none;
 		TaskState pTaskState = TaskState::none;
 		bool pBindingsClosed = false;
@@ -65,7 +66,9 @@ namespace env {
 	private:
 		bool fSetup(std::unique_ptr<env::System>&& system, uint32_t pageSize, uint32_t memoryCaches, uint32_t contextSize, bool detectWriteExecute, bool logBlocks);
 		void fAddBinding(const std::u8string& mod, const std::u8string& name);
+		bool fStartTask(std::function<void(uint32_t)> dispatch, std::function<void(std::u8string_view, bool)> callback);
 		bool fHandleTask(const std::u8string& task, std::function<void(std::u8string_view, bool)> callback);
+		bool fHandleTask(const detail::TaskRequest& request, std::function<void(std::u8string_view, bool)> callback);
 		bool fTaskCompleted(uint32_t process, std::u8string_view response);
 
 	private:
@@ -94,6 +97,7 @@ namespace env {
 
 	public:
 		uint64_t startTimeUS() const;
+		uint64_t blockIdentity() const;
 		uint32_t pageSize() const;
 		uint32_t memoryCaches() const;
 		uint32_t contextSize() const;
@@ -26,3 +26,6 @@ size_t env::detail::ProcessAccess::BindingCount() {
 bool env::detail::ProcessAccess::HandleTask(const std::u8string& task, std::function<void(std::u8string_view, bool)> callback) {
 	return env::Instance()->fHandleTask(task, callback);
 }
+bool env::detail::ProcessAccess::HandleTask(const detail::TaskRequest& request, std::function<void(std::u8string_view, bool)> callback) {
+	return env::Instance()->fHandleTask(request, callback);
+}
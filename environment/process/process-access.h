@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../env-common.h"
+#include "process-bridge.h"
 
 namespace env::detail {
 	struct ProcessAccess {
@@ -13,5 +14,6 @@ namespace env::detail {
 		static void LockBindings();
 		static size_t BindingCount();
 		static bool HandleTask(const std::u8string& task, std::function<void(std::u8string_view, bool)> callback);
+		static bool HandleTask(const detail::TaskRequest& request, std::function<void(std::u8string_view, bool)> callback);
 	};
 }
@@ -13,6 +13,9 @@ void env::detail::ProcessBridge::TaskCompleted(uint32_t process, std::u8string_v
 void env::detail::ProcessBridge::HandleTask(const std::u8string& task, uint32_t process) {
 	host_task(task.data(), uint32_t(task.size()), process);
 }
+void env::detail::ProcessBridge::HandleBinaryTask(const detail::TaskRequest& request, uint32_t process) {
+	host_binary_task(&request, process);
+}
 bool env::detail::ProcessBridge::SetExport(const std::u8string& name, uint32_t index) {
 	return (proc_export(name.data(), uint32_t(name.size()), index) > 0);
 }
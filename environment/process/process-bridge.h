@@ -5,12 +5,57 @@
 #include "../env-common.h"
 
 namespace env::detail {
+	/* opcodes of the binary tasks passed to the host (must match the host) */
+	enum class TaskOpcode : uint32_t {
+		loadCore = 0x01,
+		loadBlock = 0x02,
+		resolve = 0x10,
+		stats = 0x11,
+		path = 0x12,
+		list = 0x13,
+		accessed = 0x14,
+		changed = 0x15,
+		resize = 0x16,
+		create = 0x17,
+		read = 0x18,
+		write = 0x19,
+		readPhysical = 0x1a,
+		writePhysical = 0x1b
+	};
+
+	/* fixed-layout request of a binary task in the main memory, which is only valid for the duration of the
+	*	import-call (data references the opcode-specific buffer, string, or array of env::PhysicalRange) */
+	struct TaskRequest {
+		uint32_t opcode = 0;
+		uint32_t size = 0;
+		uint64_t data = 0;
+		uint64_t args[4] = { 0, 0, 0, 0 };
+	};
+
+	/* fixed-layout file-stats of binary responses, which are followed by the name and link and padded to eight bytes
+	*	(list-responses consist of a count followed by the records, other responses are a single uint64_t, or empty for null) */
+	struct TaskStats {
+		uint64_t id = 0;
+		uint64_t size = 0;
+		uint64_t timeAccessedUS = 0;
+		uint64_t timeModifiedUS = 0;
+		uint32_t owner = 0;
+		uint32_t group = 0;
+		uint32_t nameSize = 0;
+		uint32_t linkSize = 0;
+		uint16_t permissions = 0;
+		uint8_t type = 0;
+		uint8_t _padding[5] = { 0 };
+	};
+	static_assert(sizeof(detail::TaskRequest) == 48 && sizeof(detail::TaskStats) == 56, "Binary task layout must match the host");
+
 	struct ProcessBridge {
 		/* exports */
 		static void TaskCompleted(uint32_t process, std::u8string_view response);
 
 		/* imports */
 		static void HandleTask(const std::u8string& task, uint32_t process);
+		static void HandleBinaryTask(const detail::TaskRequest& request, uint32_t process);
 		static bool SetExport(const std::u8string& name, uint32_t index);
 		static bool SetupCoreMap();
 		static void ResetCoreMap();
@@ -64,6 +64,16 @@ gen::detail::OpenAddress gen::detail::Addresses::start() {
 	pDepth = next.depth + 1;
 	return { entry.function, next.address };
 }
+std::vector<env::guest_t> gen::detail::Addresses::linked() const {
+	std::vector<env::guest_t> out;
+
+	/* collect all addresses, which were bound to already existing blocks */
+	for (const auto& [address, place] : pTranslated) {
+		if (!place.thisModule && place.alreadyExists)
+			out.push_back(address);
+	}
+	return out;
+}
 std::vector<env::BlockExport> gen::detail::Addresses::close(const detail::MappingState& mappingState) {
 	/* setup the addresses-table limit */
 	if (pAddresses.valid())
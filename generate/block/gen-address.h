@@ -61,6 +61,7 @@ namespace gen::detail {
 		const wasm::Table& addresses();
 		bool empty() const;
 		detail::OpenAddress start();
+		std::vector<env::guest_t> linked() const;
 		std::vector<env::BlockExport> close(const detail::MappingState& mappingState);
 	};
 }
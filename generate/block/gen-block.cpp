@@ -5,8 +5,21 @@
 
 static util::Logger logger{ u8"gen::block" };
 
+namespace global {
+	/* countdown of the instructions until the next sample is taken (static to ensure its address
+	*	remains unchanged across instances, as it is embedded into the produced blocks) */
+	static int64_t SampleCountdown = gen::detail::SampleInterval;
+}
+
+static uint64_t StampNS(const gen::Statistics* statistics) {
+	/* only fetch the time-stamp if the statistics are actually being collected */
+	if (statistics == 0)
+		return 0;
+	return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 bool gen::detail::BlockAccess::Setup(detail::BlockState& state) {
-	if (gen::Instance()->trace() != gen::TraceType::none) {
+	if (gen::Instance()->tracing()) {
 		state.blockCallbackId = env::Instance()->interact().defineCallback([](uint64_t addr) -> uint64_t {
 			logger.debug(u8"Entering Block [", str::As{ U"#018x", addr }, u8']');
 			return 0;
@@ -21,6 +34,14 @@ bool gen::detail::BlockAccess::Setup(detail::BlockState& state) {
 			});
 	}
 
+	if (gen::Instance()->trace() == gen::TraceType::profile) {
+		state.sampleCallbackId = env::Instance()->interact().defineCallback([](uint64_t addr) -> uint64_t {
+			detail::GeneratorAccess::Sample(addr);
+			global::SampleCountdown += detail::SampleInterval;
+			return 0;
+			});
+	}
+
 	if (gen::Instance()->debugCheck()) {
 		state.debugCheckCallbackId = env::Instance()->interact().defineCallback([](uint64_t addr) -> uint64_t {
 			detail::GeneratorAccess::DebugCheck(addr);
@@ -68,7 +89,7 @@ void gen::Block::fProcess(const detail::OpenAddress& next) {
 	detail::GeneratorAccess::SetWriter(&writer);
 
 	/* check if block-tracing is enabled */
-	if (gen::Instance()->trace() != gen::TraceType::none) {
+	if (gen::Instance()->tracing()) {
 		gen::Add[I::U64::Const(next.address)];
 		gen::Make->invokeParam(detail::GeneratorAccess::GetBlock()->blockCallbackId);
 		gen::Add[I::Drop()];
@@ -76,12 +97,18 @@ void gen::Block::fProcess(const detail::OpenAddress& next) {
 
 	/* notify the interface about the newly starting block */
 	detail::GeneratorAccess::Get()->started(next.address);
+	gen::Statistics* statistics = gen::Instance()->statistics();
+	uint64_t stamp = StampNS(statistics);
 
 	/* iterate over the instruction stream and look for the end of the current strand */
 	gen::Instruction inst{};
+	size_t decoded = 0;
 	try {
 		do {
-			inst = detail::GeneratorAccess::Get()->fetch(block.nextFetch());
+			env::guest_t address = block.nextFetch();
+			inst = detail::GeneratorAccess::Get()->fetch(address);
+			pSource.code.push_back({ address, uint64_t(inst.size) + detail::SourceLookAhead });
+			++decoded;
 		} while (block.push(inst));
 	}
 
@@ -90,11 +117,14 @@ void gen::Block::fProcess(const detail::OpenAddress& next) {
 	*	flushing of the instruction-cache, thereby removing this stub as well - invalid
 	*	instructions will not be passed to the translator, therefore self can just be null) */
 	catch (const env::MemoryFault&) {
+		pSource.reusable = false;
 		block.readFailure();
 	}
 
 	/* setup the ranges of the super-block */
+	uint64_t decodeStamp = StampNS(statistics);
 	block.setupRanges();
+	uint64_t rangesStamp = StampNS(statistics);
 
 	/* iterate over the chunks of the super-block and produce them */
 	bool singleInstructions = (gen::Instance()->debugCheck() || gen::Instance()->trace() == gen::TraceType::instruction);
@@ -120,9 +150,32 @@ void gen::Block::fProcess(const detail::OpenAddress& next) {
 			gen::Add[I::Drop()];
 		}
 
-		/* produce the actual instructions of the chunk */
+		/* check if the chunk should be sampled (count down the instructions of the chunk and sample it, once the countdown expires) */
 		const std::vector<uintptr_t>& chunk = block.chunk();
+		if (gen::Instance()->trace() == gen::TraceType::profile) {
+			uint32_t countdown = uint32_t(uintptr_t(&global::SampleCountdown));
+			gen::Add[I::U32::Const(countdown)];
+			gen::Add[I::U32::Const(countdown)];
+			gen::Add[I::U64::Load(pContext.memory)];
+			gen::Add[I::U64::Const(chunk.size())];
+			gen::Add[I::U64::Sub()];
+			gen::Add[I::U64::Store(pContext.memory)];
+			gen::Add[I::U32::Const(countdown)];
+			gen::Add[I::U64::Load(pContext.memory)];
+			gen::Add[I::I64::Const(1)];
+			gen::Add[I::I64::Less()];
+			{
+				wasm::IfThen _if{ gen::Sink };
+				gen::Add[I::U64::Const(address)];
+				gen::Make->invokeParam(detail::GeneratorAccess::GetBlock()->sampleCallbackId);
+				gen::Add[I::Drop()];
+			}
+		}
+
+		/* produce the actual instructions of the chunk */
 		detail::GeneratorAccess::Get()->produce(address, chunk.data(), chunk.size());
+		if (statistics != 0)
+			statistics->produced += chunk.size();
 	}
 
 	/* add final debug-check stub */
@@ -138,6 +191,15 @@ void gen::Block::fProcess(const detail::OpenAddress& next) {
 	/* notify the interface about the completed block */
 	detail::GeneratorAccess::Get()->completed();
 
+	/* update the collected statistics */
+	if (statistics != 0) {
+		++statistics->blocks;
+		statistics->decoded += decoded;
+		statistics->decodeNS += decodeStamp - stamp;
+		statistics->rangesNS += rangesStamp - decodeStamp;
+		statistics->translateNS += StampNS(statistics) - rangesStamp;
+	}
+
 	/* remove the writer and sink from the generator */
 	detail::GeneratorAccess::SetWriter(0);
 	gen::Instance()->setSink(0);
@@ -150,8 +212,12 @@ void gen::Block::run(env::guest_t address) {
 }
 std::vector<env::BlockExport> gen::Block::close() {
 	std::vector<env::BlockExport> out = pAddresses.close(pMapping);
+	pSource.linked = pAddresses.linked();
 
 	/* unbind the module and close it (as a precaution) */
 	gen::Instance()->setModule(0)->close();
 	return out;
 }
+const gen::BlockSource& gen::Block::source() const {
+	return pSource;
+}
@@ -14,11 +14,17 @@
 
 namespace gen {
 	namespace detail {
+		static constexpr uint64_t SourceLookAhead = 4;
+
+		/* number of executed guest-instructions between two samples while profiling */
+		static constexpr int64_t SampleInterval = 0x4000;
+
 		struct BlockState {
 			uint32_t blockCallbackId = 0;
 			uint32_t chunkCallbackId = 0;
 			uint32_t instCallbackId = 0;
 			uint32_t debugCheckCallbackId = 0;
+			uint32_t sampleCallbackId = 0;
 		};
 
 		struct BlockAccess {
@@ -26,6 +32,14 @@ namespace gen {
 		};
 	}
 
+	/* guest-code and already existing blocks, which a produced block depends upon
+	*	Note: code-ranges include a look-ahead past each fetched instruction, as translators may inspect it */
+	struct BlockSource {
+		std::vector<std::pair<env::guest_t, uint64_t>> code;
+		std::vector<env::guest_t> linked;
+		bool reusable = true;
+	};
+
 	/* env::Process instance and gen::Generator instance must be created
 	*	Note: blocks must not be flushed mid block-creation
 	*	Note: after closing the block, no changes can be made to the block anymore */
@@ -37,6 +51,7 @@ namespace gen {
 		detail::MappingState pMapping;
 		detail::ContextState pContext;
 		detail::InteractState pInteract;
+		gen::BlockSource pSource;
 
 	public:
 		Block(wasm::Module& mod);
@@ -49,5 +64,6 @@ namespace gen {
 	public:
 		void run(env::guest_t address);
 		std::vector<env::BlockExport> close();
+		const gen::BlockSource& source() const;
 	};
 }
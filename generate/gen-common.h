@@ -11,6 +11,7 @@
 #include <set>
 #include <memory>
 #include <iterator>
+#include <chrono>
 
 #include "../environment/env-common.h"
 #include "../util/util-logger.h"
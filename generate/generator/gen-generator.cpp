@@ -66,6 +66,9 @@ bool gen::detail::GeneratorAccess::CoreCreated() {
 void gen::detail::GeneratorAccess::DebugCheck(env::guest_t address) {
 	global::Instance->pDebugCheck(address);
 }
+void gen::detail::GeneratorAccess::Sample(env::guest_t address) {
+	++global::Instance->pSamples[address];
+}
 
 
 bool gen::Generator::fSetup(std::unique_ptr<gen::Translator>&& translator, uint32_t translationDepth, gen::TraceType trace, std::function<void(env::guest_t)> debugCheck) {
@@ -96,6 +99,9 @@ uint32_t gen::Generator::translationDepth() const {
 gen::TraceType gen::Generator::trace() const {
 	return pTrace;
 }
+bool gen::Generator::tracing() const {
+	return (pTrace != gen::TraceType::none && pTrace != gen::TraceType::profile);
+}
 bool gen::Generator::debugCheck() const {
 	return bool(pDebugCheck);
 }
@@ -113,3 +119,13 @@ wasm::Sink* gen::Generator::setSink(wasm::Sink* sink) {
 	gen::Sink = pSink;
 	return sink;
 }
+gen::Statistics* gen::Generator::statistics() const {
+	return pStatistics;
+}
+gen::Statistics* gen::Generator::setStatistics(gen::Statistics* statistics) {
+	std::swap(pStatistics, statistics);
+	return statistics;
+}
+std::unordered_map<env::guest_t, uint64_t> gen::Generator::takeSamples() {
+	return std::exchange(pSamples, {});
+}
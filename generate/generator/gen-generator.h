@@ -10,7 +10,18 @@ namespace gen {
 		none,
 		block,
 		chunk,
-		instruction
+		instruction,
+		profile
+	};
+
+	/* statistics collected while translating blocks (only collected, if attached to the generator) */
+	struct Statistics {
+		uint64_t blocks = 0;
+		uint64_t decoded = 0;
+		uint64_t produced = 0;
+		uint64_t decodeNS = 0;
+		uint64_t rangesNS = 0;
+		uint64_t translateNS = 0;
 	};
 
 	namespace detail {
@@ -21,6 +32,7 @@ namespace gen {
 			static detail::BlockState* GetBlock();
 			static bool CoreCreated();
 			static void DebugCheck(env::guest_t address);
+			static void Sample(env::guest_t address);
 		};
 	}
 
@@ -29,9 +41,11 @@ namespace gen {
 	private:
 		std::unique_ptr<gen::Translator> pTranslator;
 		std::function<void(env::guest_t)> pDebugCheck;
+		std::unordered_map<env::guest_t, uint64_t> pSamples;
 		detail::BlockState pBlockState;
 		wasm::Module* pModule = 0;
 		wasm::Sink* pSink = 0;
+		gen::Statistics* pStatistics = 0;
 		uint32_t pTranslationDepth = 0;
 		gen::TraceType pTrace = gen::TraceType::none;
 
@@ -48,9 +62,15 @@ namespace gen {
 	public:
 		uint32_t translationDepth() const;
 		gen::TraceType trace() const;
+		bool tracing() const;
 		bool debugCheck() const;
 		wasm::Module* setModule(wasm::Module* mod);
 		wasm::Sink* setSink(wasm::Sink* sink);
+		gen::Statistics* statistics() const;
+		gen::Statistics* setStatistics(gen::Statistics* statistics);
+
+		/* fetch and reset the samples per chunk-address collected while profiling */
+		std::unordered_map<env::guest_t, uint64_t> takeSamples();
 	};
 }
 
@@ -71,6 +91,9 @@ template <> struct str::Formatter<gen::TraceType> {
 		case gen::TraceType::instruction:
 			str::FastcodeAllTo(sink, U"Instruction");
 			break;
+		case gen::TraceType::profile:
+			str::FastcodeAllTo(sink, U"Profile");
+			break;
 		default:
 			str::FastcodeAllTo(sink, U"%Unknown%");
 			break;
@@ -10,7 +10,7 @@ enum class GroupId : uint8_t {
 	inBreak, inPrint, inReg, inInst, inMem8, inMem16, inMem32, inMem64, inEval
 };
 enum class OptionId : uint8_t {
-	debug, environment, depth, trace, log, bind, description
+	debug, environment, depth, trace, log, bind, description, checkpoint, restore
 };
 static arger::Config Commands{ false,
 	arger::GroupName{ "command" },
@@ -66,6 +66,7 @@ static arger::Config Commands{ false,
 				arger::EnumEntry{ "inst", gen::TraceType::instruction, "Trace each executed instruction." },
 				arger::EnumEntry{ "chunk", gen::TraceType::chunk, "Trace each entered instruction chunk." },
 				arger::EnumEntry{ "block", gen::TraceType::block, "Trace each entered super-block." },
+				arger::EnumEntry{ "profile", gen::TraceType::profile, "Sample executed instructions and report them per guest function on exit." },
 				arger::EnumEntry{ "none", gen::TraceType::none, "Do not perform any tracing." },
 			}},
 			arger::Default{ "none" },
@@ -76,6 +77,14 @@ static arger::Config Commands{ false,
 			arger::Default{ uint64_t(sys::DefTranslationDepth) },
 			arger::Description{ "Configure the depth to which super-blocks should be crawled and translated at once." },
 		},
+		arger::Option{ "checkpoint", OptionId::checkpoint,
+			arger::Payload{ "path", arger::Primitive::any },
+			arger::Description{ "Write a snapshot of the process to the path, once it performs the checkpoint-syscall." },
+		},
+		arger::Option{ "restore", OptionId::restore,
+			arger::Payload{ "path", arger::Primitive::any },
+			arger::Description{ "Resume the process from the snapshot at the path instead of loading the binary (binary, arguments, and environment must match the snapshot)." },
+		},
 	},
 	arger::Group{ "destroy", GroupId::destroy,
 		arger::Description{ "Destroy the currently configured translation process." },
@@ -291,6 +300,8 @@ void HandleCommand(std::u8string_view cmd) {
 		bool debug = out.flag(OptionId::debug);
 		sys::RunConfig config{
 			.binary = out.positional(0).value().str<char8_t>(),
+			.checkpoint = out.option(OptionId::checkpoint).value_or(u8"").str<char8_t>(),
+			.restore = out.option(OptionId::restore).value_or(u8"").str<char8_t>(),
 			.translationDepth = uint32_t(out.option(OptionId::depth).value().unum()),
 			.trace = out.option(OptionId::trace).value().id<gen::TraceType>(),
 			.logBlocks = out.flag(OptionId::log)
@@ -1,8 +1,21 @@
 /* SPDX-License-Identifier: BSD-3-Clause */
 /* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include <algorithm>
+
 #include "host-interact.h"
 #include "../host/interface.h"
 
+namespace global {
+	/* buffered terminal output in the main memory, which is drained by the host in bulk */
+	static constexpr size_t OutCapacity = 0x10000;
+	static constexpr size_t OutLineThreshold = 64;
+	static constexpr uint64_t OutDelayUS = 50'000;
+	static char8_t OutBuffer[global::OutCapacity];
+	static size_t OutSize = 0;
+	static size_t OutLines = 0;
+	static uint64_t OutFirstUS = 0;
+}
+
 extern "C" void emscripten_notify_memory_growth(uint32_t) {
 	host_check_metrics();
 }
@@ -23,12 +36,61 @@ void host::HostCheckMetrics() {
 	host_check_metrics();
 }
 
+bool host::PerfMapEnabled() {
+	return (host_perf_map() != 0);
+}
+
+void host::PerfMapSymbol(std::u8string_view name, std::u8string_view symbol) {
+	std::u8string actual = str::u8::Build(name, u8' ', symbol);
+	host_perf_symbol(actual.data(), uint32_t(actual.size()));
+}
+
 void host::PrintOut(std::u8string_view msg) {
+	host::FlushOut();
 	std::u8string actual = str::u8::Build(u8"O:", msg);
 	host_message(actual.data(), uint32_t(actual.size()));
 }
 
 void host::PrintOutLn(std::u8string_view msg) {
+	host::FlushOut();
 	std::u8string actual = str::u8::Build(u8"O:", msg, u8'\n');
 	host_message(actual.data(), uint32_t(actual.size()));
 }
+
+void host::BufferOut(std::u8string_view msg) {
+	/* flush the pending output, if the message does not fit anymore, and pass too large messages out directly */
+	if (global::OutSize + msg.size() > global::OutCapacity) {
+		host::FlushOut();
+		if (msg.size() > global::OutCapacity) {
+			host_output(msg.data(), uint32_t(msg.size()));
+			return;
+		}
+	}
+
+	/* append the message to the buffer */
+	if (global::OutSize == 0)
+		global::OutFirstUS = host_time_us();
+	std::copy(msg.begin(), msg.end(), global::OutBuffer + global::OutSize);
+	global::OutSize += msg.size();
+	size_t lines = std::count(msg.begin(), msg.end(), u8'\n');
+	if (lines == 0)
+		return;
+
+	/* flush the output once enough lines have accumulated or a completed line has been pending for too long */
+	global::OutLines += lines;
+	if (global::OutLines >= global::OutLineThreshold || host_time_us() - global::OutFirstUS >= global::OutDelayUS)
+		host::FlushOut();
+}
+
+void host::FlushOutExpired() {
+	if (global::OutSize > 0 && host_time_us() - global::OutFirstUS >= global::OutDelayUS)
+		host::FlushOut();
+}
+
+void host::FlushOut() {
+	if (global::OutSize == 0)
+		return;
+	host_output(global::OutBuffer, uint32_t(global::OutSize));
+	global::OutSize = 0;
+	global::OutLines = 0;
+}
@@ -19,9 +19,25 @@ namespace host {
 	/* notify the host to check the performance metrics */
 	void HostCheckMetrics();
 
+	/* check if the host associates the exported functions of translated blocks with guest symbols (for external profilers) */
+	bool PerfMapEnabled();
+
+	/* pass the guest symbol of an exported function of a translated block to the host */
+	void PerfMapSymbol(std::u8string_view name, std::u8string_view symbol);
+
 	/* direct logs to output without logging wrapper */
 	void PrintOut(std::u8string_view msg);
 
 	/* direct logs to output without logging wrapper */
 	void PrintOutLn(std::u8string_view msg);
+
+	/* buffer terminal output, which is passed to the host in bulk once enough lines have accumulated, it has been
+	*	pending for too long, or it is explicitly flushed (must be flushed before blocking on input and at exit) */
+	void BufferOut(std::u8string_view msg);
+
+	/* pass all buffered terminal output to the host */
+	void FlushOut();
+
+	/* pass the buffered terminal output to the host, if it has been pending for too long (to be checked whenever the guest enters the system) */
+	void FlushOutExpired();
 }
@@ -26,12 +26,16 @@ extern "C" {
 
 	/* imports */
 	void host_task(const char8_t* task, uint32_t size, uint32_t process);
+	void host_binary_task(const void* request, uint32_t process);
 	void host_message(const char8_t* data, uint32_t size);
+	void host_output(const char8_t* data, uint32_t size);
 	void host_failure(const char8_t* data, uint32_t size);
 	uint32_t host_random();
 	uint64_t host_time_us();
 	int32_t host_timezone_min();
 	void host_check_metrics();
+	uint32_t host_perf_map();
+	void host_perf_symbol(const char8_t* data, uint32_t size);
 }
 
 /* environment/process/process-bridge interactions */
@@ -38,8 +38,8 @@ export interface HostEnvironment {
 	/* load the main-module */
 	loadMain(imports: WebAssembly.Imports): Promise<WebAssembly.Instance>;
 
-	/* load any module */
-	loadModule(imports: WebAssembly.Imports, buffer: ArrayBuffer): Promise<WebAssembly.Instance>;
+	/* compile any module (instantiated by wasmlator, which reuses compiled modules across instances) */
+	compileModule(buffer: ArrayBuffer): Promise<WebAssembly.Module>;
 
 	/* read user input */
 	readInput(): Promise<string>;
@@ -47,9 +47,12 @@ export interface HostEnvironment {
 	/* fetch the stats for the given path */
 	fsLoadStats(path: string): Promise<FileStats | null>;
 
-	/* fetch the data for the given path (of which the stats exist) */
-	fsLoadData(path: string): Promise<Uint8Array>;
+	/* fetch the range of data for the given path (of which the stats exist - shorter if the end of the file has been reached) */
+	fsLoadRange(path: string, offset: number, size: number): Promise<Uint8Array>;
 
-	/* fetch all children for the given path */
-	fsLoadChildren(path: string): Promise<string[]>;
+	/* fetch all children with their stats for the given path in a single batch (children with invalid stats are omitted) */
+	fsLoadChildrenWithStats(path: string): Promise<Record<string, FileStats>>;
+
+	/* associate the exported function of a translated block with its guest symbol (optional, enables the symbolization of translated blocks for external profilers) */
+	perfSymbol?(name: string, symbol: string): void;
 }
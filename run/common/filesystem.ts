@@ -7,7 +7,9 @@ class FileNode {
 	public ancestor: FileNode | null;
 	public stats: FileStats | null;
 	public name: string;
-	public data: Uint8Array | null;
+	public pristine: Map<number, Uint8Array>;
+	public modified: Map<number, Uint8Array>;
+	public source: number;
 	public id: number;
 	public childrenFetched: boolean;
 
@@ -16,7 +18,9 @@ class FileNode {
 		this.ancestor = ancestor;
 		this.stats = null;
 		this.name = name;
-		this.data = null;
+		this.pristine = new Map<number, Uint8Array>();
+		this.modified = new Map<number, Uint8Array>();
+		this.source = 0;
 		this.id = id;
 		this.childrenFetched = false;
 	}
@@ -27,6 +31,7 @@ class FileNode {
 		this.stats.owner = access.owner;
 		this.stats.group = access.group;
 		this.stats.permissions = access[this.stats.type];
+		this.source = this.stats.size;
 	}
 	read() {
 		this.stats!.atime_us = Date.now() * 1000;
@@ -36,7 +41,11 @@ class FileNode {
 	}
 }
 
+/* file data are stored sparsely in chunks of the given size: pristine chunks are fetched lazily from the host (only
+*	within the source-size, which only ever shrinks), while written chunks are copied on write into the modified chunks
+*	(chunks, which exist in neither, are holes and read as zero - chunks might be shorter than the chunk-size) */
 export class FileSystem {
+	static readonly ChunkSize: number = 64 * 1024;
 	static readonly fsRoot: Record<string, number> = {
 		owner: 0,
 		group: 0,
@@ -77,6 +86,12 @@ export class FileSystem {
 		} while ((node = node.ancestor!) != null && node.ancestor != null);
 		return path;
 	}
+	_makeChild(node: FileNode, name: string): FileNode {
+		let next = new FileNode(node, this.nodes.length, name);
+		this.nodes.push(next);
+		node.children[name] = next;
+		return next;
+	}
 	async _getNode(node: FileNode, current: string, path: string): Promise<FileNode | null> {
 		/* check if the end has been reached */
 		if (path.length == 0 || path == '/')
@@ -104,14 +119,13 @@ export class FileSystem {
 		if (name in node.children)
 			return this._getNode(node.children[name], actual, path);
 
-		/* check if the node itself is valid (i.e. exists in the read-only file-system) and is a directory */
-		if (node.stats == null || node.stats.type != 'dir')
+		/* check if the node itself is valid (i.e. exists in the read-only file-system) and is a directory, and
+		*	check if all children have already been fetched, in which case the child cannot exist */
+		if (node.stats == null || node.stats.type != 'dir' || node.childrenFetched)
 			return null;
 
 		/* setup the new node */
-		let next = new FileNode(node, this.nodes.length, name);
-		this.nodes.push(next);
-		node.children[name] = next;
+		let next = this._makeChild(node, name);
 
 		/* request the stats (on errors, just pretend the object does not exist) */
 		this.host.log(LogType.logInternal, `Fetching stats for [${actual}]...`);
@@ -126,28 +140,120 @@ export class FileSystem {
 		}
 		return this._getNode(next, actual, path);
 	}
-	async _loadData(node: FileNode): Promise<void> {
-		/* check if the data already exist */
-		if (node.data != null)
-			return;
+	async _fetchRange(path: string, buffer: Uint8Array, offset: number): Promise<void> {
+		/* fetch the range of data from the host (any data not received are treated as zero) */
+		try {
+			let data = await this.host.fsLoadRange(path, offset, buffer.byteLength);
+			buffer.set(data.subarray(0, Math.min(data.byteLength, buffer.byteLength)));
+		}
+		catch (err) {
+			this.host.log(LogType.errInternal, `Failed to read range [${offset}] of [${path}]: ${err}`);
+		}
+	}
+	async _loadChunk(node: FileNode, index: number): Promise<Uint8Array | null> {
+		/* check if the chunk has been modified or has already been fetched */
+		let chunk = node.modified.get(index) ?? node.pristine.get(index);
+		if (chunk != undefined)
+			return chunk;
+
+		/* check if the chunk lies beyond the source-data, in which case it is a hole */
+		let offset = index * FileSystem.ChunkSize;
+		if (offset >= node.source)
+			return null;
 		let path = this._getNodePath(node);
 
-		/* fetch the existing file data */
-		this.host.log(LogType.logInternal, `Reading file [${path}]...`);
-		try {
-			let buf = await this.host.fsLoadData(path);
-			this.host.log(LogType.logInternal, `Data of [${path}] received`);
+		/* fetch the chunk (the last chunk only covers the remainder of the source) */
+		this.host.log(LogType.logInternal, `Reading chunk [${index}] of file [${path}]...`);
+		chunk = new Uint8Array(Math.min(FileSystem.ChunkSize, node.source - offset));
+		await this._fetchRange(path, chunk, offset);
+		this.host.log(LogType.logInternal, `Chunk [${index}] of [${path}] received`);
+
+		/* check if the chunk has been fetched or written by another task in the meantime or the source has been reduced */
+		let existing = node.modified.get(index) ?? node.pristine.get(index);
+		if (existing != undefined)
+			return existing;
+		if (offset >= node.source)
+			return null;
+		chunk = chunk.subarray(0, Math.min(chunk.byteLength, node.source - offset));
+		node.pristine.set(index, chunk);
+		return chunk;
+	}
+	async _readChunks(node: FileNode, buffer: Uint8Array, offset: number): Promise<void> {
+		/* copy the data chunk by chunk and only fetch the chunks, which are actually touched (missing data are zero) */
+		let done = 0;
+		while (done < buffer.byteLength) {
+			let index = Math.floor((offset + done) / FileSystem.ChunkSize), start = (offset + done) % FileSystem.ChunkSize;
+			let count = Math.min(buffer.byteLength - done, FileSystem.ChunkSize - start);
+			let target = buffer.subarray(done, done + count);
+
+			let chunk = await this._loadChunk(node, index);
+			let available = (chunk == null ? 0 : Math.max(0, Math.min(count, chunk.byteLength - start)));
+			if (available > 0)
+				target.set(chunk!.subarray(start, start + available));
+			target.fill(0, available);
+			done += count;
+		}
+	}
+	async _writeChunks(node: FileNode, buffer: Uint8Array, offset: number): Promise<number> {
+		/* copy the data chunk by chunk into the modified chunks */
+		let done = 0;
+		while (done < buffer.byteLength) {
+			let index = Math.floor((offset + done) / FileSystem.ChunkSize), start = (offset + done) % FileSystem.ChunkSize;
+			let count = Math.min(buffer.byteLength - done, FileSystem.ChunkSize - start);
+
+			/* check if the chunk needs to be copied or grown (only fetch the pristine data, if they are not overwritten entirely) */
+			let end = start + count;
+			let chunk = node.modified.get(index);
+			if (chunk == undefined || chunk.byteLength < end) {
+				let base: Uint8Array | null = (chunk ?? null);
+				if (base == null && count < FileSystem.ChunkSize)
+					base = await this._loadChunk(node, index);
+				chunk = node.modified.get(index);
+				if (chunk != undefined)
+					base = chunk;
+
+				/* modified chunks only cover the written data and grow geometrically up to the chunk-size,
+				*	as small files would otherwise each occupy an entire chunk (missing data read as zero) */
+				if (chunk == undefined || chunk.byteLength < end) {
+					let size = Math.max(end, base?.byteLength ?? 0, 2 * (chunk?.byteLength ?? 0));
+					try {
+						chunk = new Uint8Array(Math.min(FileSystem.ChunkSize, size));
+					} catch (e) {
+						this.host.log(LogType.errInternal, `Failed to allocate memory for node [${this._getNodePath(node)}]`);
+						break;
+					}
+					if (base != null)
+						chunk.set(base);
+					node.modified.set(index, chunk);
+					node.pristine.delete(index);
+				}
+			}
 
-			/* write the data to the node */
-			node.data = buf;
-			node.stats!.size = node.data.byteLength;
+			/* write the data to the chunk */
+			chunk.set(buffer.subarray(done, done + count), start);
+			done += count;
 		}
-		catch (err) {
-			/* pretend the file is empty */
-			this.host.log(LogType.errInternal, `Failed to read data of [${path}]: ${err}`);
-			node.stats!.size = 0;
-			node.data = new Uint8Array(0);
+		return done;
+	}
+	_truncateChunks(node: FileNode, size: number): void {
+		node.source = Math.min(node.source, size);
+
+		/* release all chunks beyond the new size */
+		for (const chunks of [node.pristine, node.modified]) {
+			for (const index of [...chunks.keys()]) {
+				if (index * FileSystem.ChunkSize >= size)
+					chunks.delete(index);
+			}
 		}
+
+		/* clear the remainder of the last chunk to ensure it reads as zero once the file grows again */
+		let index = Math.floor(size / FileSystem.ChunkSize), start = size % FileSystem.ChunkSize;
+		if (start == 0)
+			return;
+		node.modified.get(index)?.fill(0, start);
+		let pristine = node.pristine.get(index);
+		if (pristine != undefined && pristine.byteLength > start)
+			node.pristine.set(index, pristine.subarray(0, start));
 	}
 	async _loadChildren(node: FileNode): Promise<void> {
 		/* check if the children have already been fetched */
@@ -155,16 +261,20 @@ export class FileSystem {
 			return;
 		let path = this._getNodePath(node);
 
-		/* query the children */
+		/* query the children and their stats in a single batch */
 		this.host.log(LogType.logInternal, `Reading directory [${path}]...`);
 		try {
-			let list = await this.host.fsLoadChildren(path);
+			let list = await this.host.fsLoadChildrenWithStats(path);
 			this.host.log(LogType.logInternal, `Children of [${path}] received`);
 
-			/* iterate over the children and fetch their stats (will automatically
-			*	add the existing children with valid names to the list) */
-			for (const name of list)
-				await this._getNode(node, path, name);
+			/* add all children with valid names, which do not exist yet (already known children might have been modified) */
+			for (const name in list) {
+				if (['', '.', '..'].includes(name) || name.includes('/') || name.includes('\\'))
+					continue;
+				let next = node.children[name] ?? this._makeChild(node, name);
+				if (next.stats == null)
+					next.setupStats(list[name], FileSystem.fsDefault);
+			}
 		}
 		catch (err) {
 			/* pretend the directory does not have any children (at least no further than the already existing children) */
@@ -211,98 +321,81 @@ export class FileSystem {
 		if (node == null || node.stats!.type != 'file')
 			return false;
 
-		/* check if the size should be set to zero */
-		if (size == 0) {
-			node.stats!.size = 0;
-			node.data = new Uint8Array(0);
-			return true;
-		}
-
-		/* fetch the data of the file and check if the given size already matches */
-		await this._loadData(node);
-		if (size == node.stats!.size)
-			return true;
-
-		/* check if the file should be reduced in size */
-		if (size <= node.stats!.size) {
-			node.stats!.size = size;
-			node.data = node.data!.slice(0, size);
-			return true;
-		}
-
-		/* increase the size of the buffer */
-		try {
-			let buf = new Uint8Array(size);
-			buf.set(node.data!, 0);
-			node.stats!.size = size;
-			node.data = buf;
-			return true;
-		} catch (e) {
-			this.host.log(LogType.errInternal, `Failed to allocate memory for node [${this._getNodePath(node)}]`);
-			return false;
-		}
+		/* release the data beyond the new size (growing only moves the end, as the new range is a hole) */
+		if (size < node.stats!.size)
+			this._truncateChunks(node, size);
+		node.stats!.size = size;
+		return true;
 	}
 	async fileRead(id: number, buffer: Uint8Array, offset: number): Promise<number | null> {
 		let node = this._getValid(id);
 		if (node == null || node.stats!.type != 'file')
 			return null;
 
-		/* fetch the data of the node */
-		await this._loadData(node);
-
 		/* compute the number of bytes to read */
 		let count = Math.min(buffer.byteLength, node.stats!.size - offset);
 		if (count <= 0)
 			return 0;
 
-		/* read the data to the buffer */
-		buffer.set(node.data!.slice(offset, offset + count));
+		/* read the data to the buffer (without an intermediate copy - only the touched chunks are fetched) */
+		await this._readChunks(node, buffer.subarray(0, count), offset);
 		return count;
 	}
+	async fileReadRanges(id: number, buffers: Uint8Array[], offset: number): Promise<number | null> {
+		let total = 0;
+
+		/* scatter the data into the buffers until the end of the file has been reached */
+		for (const buffer of buffers) {
+			let count = await this.fileRead(id, buffer, offset + total);
+			if (count == null)
+				return (total == 0 ? null : total);
+			total += count;
+			if (count < buffer.byteLength)
+				break;
+		}
+		return total;
+	}
 	async fileWrite(id: number, buffer: Uint8Array, offset: number): Promise<number | null> {
 		let node = this._getValid(id);
 		if (node == null || node.stats!.type != 'file')
 			return null;
 
-		/* fetch the data of the node */
-		await this._loadData(node);
-
-		/* check if the file needs to be resized */
-		let count = buffer.byteLength;
-		if (offset + buffer.byteLength > node.stats!.size) {
-			try {
-				let buf = new Uint8Array(offset + buffer.byteLength);
-				buf.set(node.data!.slice(0, offset));
-				node.stats!.size = buf.byteLength;
-				node.data = buf;
-			} catch (e) {
-				this.host.log(LogType.errInternal, `Failed to allocate memory for node [${this._getNodePath(node)}]`);
-				count = Math.min(buffer.byteLength, node.stats!.size - offset);
-			}
-		}
-
-		/* check if any bytes are to be written */
-		if (count <= 0)
-			return 0;
-
-		/* write the data to the buffer */
-		node.data!.set(buffer.slice(0, count), offset);
+		/* write the data to the chunks and move the end of the file, if the file has been extended */
+		let count = await this._writeChunks(node, buffer, offset);
+		if (offset + count > node.stats!.size)
+			node.stats!.size = offset + count;
 		return count;
 	}
+	async fileWriteRanges(id: number, buffers: Uint8Array[], offset: number): Promise<number | null> {
+		let total = 0;
+
+		/* gather the data from the buffers until a write fails to be completed */
+		for (const buffer of buffers) {
+			let count = await this.fileWrite(id, buffer, offset + total);
+			if (count == null)
+				return (total == 0 ? null : total);
+			total += count;
+			if (count < buffer.byteLength)
+				break;
+		}
+		return total;
+	}
 	async fileCreate(id: number, name: string, owner: number, group: number, permissions: number): Promise<number | null> {
 		let node = this._getValid(id);
 		if (node == null || node.stats!.type != 'dir')
 			return null;
 
-		/* check if the child already exists (cannot return null as parent itself exists - provided that name does not contain a slash) */
-		let next = (await this._getNode(node, this._getNodePath(node), name))!;
-		if (next.stats != null)
+		/* check if the child already exists (null if the children of the parent have been fetched entirely and the child does not exist) */
+		let next = await this._getNode(node, this._getNodePath(node), name);
+		if (next != null && next.stats != null)
 			return null;
+		if (next == null)
+			next = this._makeChild(node, name);
 
-		/* setup the new file (including empty data to prevent loading non-existing file) */
+		/* setup the new file (without any source to prevent loading non-existing file) */
 		next.setupStats(new FileStats('file'), { owner: owner, group: group, file: permissions });
 		next.stats!.size = 0;
-		next.data = new Uint8Array(0);
+		next.source = 0;
 		return next.id;
 	}
 	async directoryRead(id: number): Promise<Record<string, FileStats> | null> {
@@ -325,8 +418,12 @@ export class FileSystem {
 		let total: number = 0;
 
 		/* sum up the total buffered memory */
-		for (const node of this.nodes)
-			total += (node.data?.byteLength ?? 0);
+		for (const node of this.nodes) {
+			for (const chunk of node.pristine.values())
+				total += chunk.byteLength;
+			for (const chunk of node.modified.values())
+				total += chunk.byteLength;
+		}
 		return total;
 	}
 }
@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+import { HostEnvironment } from './common.js';
+import { FileSystem } from './filesystem.js';
+import { TaskOpcode, TaskRequest } from './task-protocol.js';
+
+/* layout of the shared channel: [state, request-size, response-size, unused] followed by the text and the data-region
+*	(requests are passed as json-encoded decoded tasks, as the server cannot access the memory of the client) */
+enum ChannelState { idle, pending, completed };
+const HeaderSize = 16;
+const TextCapacity = 1024 * 1024;
+const DataOffset = HeaderSize + TextCapacity;
+const DataCapacity = 1024 * 1024;
+
+/* prepare the execution of a file-system task (null if the opcode is not a file-system task)
+*	Note: buffer refers to the main memory, while guest refers to the physical guest memory, which is used by the physical tasks */
+export function DispatchFileTask(fs: FileSystem, task: TaskRequest, buffer: (ptr: number, size: number) => Uint8Array, guest: (ptr: number, size: number) => Uint8Array): (() => Promise<any>) | null {
+	let args = task.args;
+	switch (task.opcode) {
+		case TaskOpcode.resolve:
+			return () => fs.getNode(task.text);
+		case TaskOpcode.stats:
+			return () => fs.getStats(args[0], task.text);
+		case TaskOpcode.path:
+			return () => fs.getPath(args[0]);
+		case TaskOpcode.accessed:
+			return () => fs.setRead(args[0]);
+		case TaskOpcode.changed:
+			return () => fs.setWritten(args[0]);
+		case TaskOpcode.resize:
+			return () => fs.fileResize(args[0], args[1]);
+		case TaskOpcode.read:
+			return () => fs.fileRead(args[0], buffer(task.ptr, task.size), args[1]);
+		case TaskOpcode.write:
+			return () => fs.fileWrite(args[0], buffer(task.ptr, task.size), args[1]);
+		case TaskOpcode.readPhysical:
+			return () => fs.fileReadRanges(args[0], task.ranges.map(([ptr, size]) => guest(ptr, size)), args[1]);
+		case TaskOpcode.writePhysical:
+			return () => fs.fileWriteRanges(args[0], task.ranges.map(([ptr, size]) => guest(ptr, size)), args[1]);
+		case TaskOpcode.create:
+			return () => fs.fileCreate(args[0], task.text, args[1], args[2], args[3]);
+		case TaskOpcode.list:
+			return () => fs.directoryRead(args[0]);
+	}
+	return null;
+}
+
+/* allocate the shared memory for a channel between a client and a server */
+export function CreateSyncChannel(): SharedArrayBuffer {
+	return new SharedArrayBuffer(DataOffset + DataCapacity);
+}
+
+/* client-side of the channel, which blocks on the channel until the server has performed the file-system
+*	task, which allows the task to be completed in-place (must not run on the same thread as the server) */
+export class SyncFileClient {
+	private channel: SharedArrayBuffer;
+	private header: Int32Array;
+	private notify: () => void;
+
+	public constructor(channel: SharedArrayBuffer, notify: () => void) {
+		this.channel = channel;
+		this.header = new Int32Array(channel, 0, HeaderSize / 4);
+		this.notify = notify;
+	}
+
+	private exchange(task: TaskRequest): any {
+		/* write the request to the channel and notify the server */
+		let text = new TextEncoder().encode(JSON.stringify(task));
+		new Uint8Array(this.channel, HeaderSize, text.length).set(text);
+		this.header[1] = text.length;
+		Atomics.store(this.header, 0, ChannelState.pending);
+		this.notify();
+
+		/* block until the server has written the response (decoded from a copy, as text cannot be decoded from shared memory) */
+		while (Atomics.load(this.header, 0) == ChannelState.pending)
+			Atomics.wait(this.header, 0, ChannelState.pending);
+		let response = new TextDecoder('utf-8').decode(new Uint8Array(this.channel, HeaderSize, this.header[2]).slice());
+		Atomics.store(this.header, 0, ChannelState.idle);
+		return (response.length == 0 ? null : JSON.parse(response));
+	}
+	private transfer(opcode: TaskOpcode, id: number, ptr: number, offset: number, size: number, memory: ArrayBuffer): number | null {
+		/* split the transfer into chunks, which fit into the data-region of the channel */
+		let total = 0;
+		while (total < size) {
+			let chunk = Math.min(size - total, DataCapacity);
+			if (opcode == TaskOpcode.write)
+				new Uint8Array(this.channel, DataOffset, chunk).set(new Uint8Array(memory, ptr + total, chunk));
+			let result: number | null = this.exchange({ opcode: opcode, args: [id, offset + total, 0, 0], ptr: 0, size: chunk, text: '', ranges: [] });
+			if (result == null)
+				return (total == 0 ? null : total);
+			if (opcode == TaskOpcode.read)
+				new Uint8Array(memory, ptr + total, result).set(new Uint8Array(this.channel, DataOffset, result));
+			total += result;
+			if (result < chunk)
+				break;
+		}
+		return total;
+	}
+
+	private transferRanges(opcode: TaskOpcode, task: TaskRequest, guest: ArrayBuffer): number | null {
+		/* transfer the ranges one after another until a range could not be transferred entirely */
+		let total = 0;
+		for (const [ptr, size] of task.ranges) {
+			let result = this.transfer(opcode, task.args[0], ptr, task.args[1] + total, size, guest);
+			if (result == null)
+				return (total == 0 ? null : total);
+			total += result;
+			if (result < size)
+				break;
+		}
+		return total;
+	}
+
+	/* perform the file-system task synchronously (null if the opcode is not a file-system task) */
+	public perform(task: TaskRequest, memory: ArrayBuffer, guest: ArrayBuffer): { value: any } | null {
+		if (task.opcode == TaskOpcode.read || task.opcode == TaskOpcode.write)
+			return { value: this.transfer(task.opcode, task.args[0], task.ptr, task.args[1], task.size, memory) };
+		if (task.opcode == TaskOpcode.readPhysical)
+			return { value: this.transferRanges(TaskOpcode.read, task, guest) };
+		if (task.opcode == TaskOpcode.writePhysical)
+			return { value: this.transferRanges(TaskOpcode.write, task, guest) };
+		if (task.opcode < TaskOpcode.resolve || task.opcode > TaskOpcode.writePhysical)
+			return null;
+		return { value: this.exchange(task) };
+	}
+}
+
+/* server-side of the channel, which owns the file-system and performs the tasks of the client */
+export class SyncFileServer {
+	private fs: FileSystem;
+	private channel: SharedArrayBuffer;
+	private header: Int32Array;
+
+	public constructor(host: HostEnvironment, channel: SharedArrayBuffer) {
+		this.fs = new FileSystem(host);
+		this.channel = channel;
+		this.header = new Int32Array(channel, 0, HeaderSize / 4);
+	}
+
+	/* handle the pending request (to be invoked whenever the client notified the server) */
+	public async handle(): Promise<void> {
+		if (Atomics.load(this.header, 0) != ChannelState.pending)
+			return;
+
+		/* decode the task (data of read/write is always transferred through the data-region) */
+		let task: TaskRequest = JSON.parse(new TextDecoder('utf-8').decode(new Uint8Array(this.channel, HeaderSize, this.header[1]).slice()));
+		let perform = DispatchFileTask(this.fs, task, (_, size) => new Uint8Array(this.channel, DataOffset, size), (_, size) => new Uint8Array(this.channel, DataOffset, size));
+
+		/* perform the task and write the response back (failed tasks and too large responses are returned as null, as the client would otherwise block forever) */
+		let result: any = null;
+		try {
+			if (perform != null)
+				result = await perform();
+		} catch (_) { }
+		let text = new TextEncoder().encode(result == null ? '' : JSON.stringify(result));
+		if (text.length > TextCapacity)
+			text = new Uint8Array();
+		new Uint8Array(this.channel, HeaderSize, text.length).set(text);
+		this.header[2] = text.length;
+		Atomics.store(this.header, 0, ChannelState.completed);
+		Atomics.notify(this.header, 0);
+	}
+	public totalMemory(): number {
+		return this.fs.totalMemory();
+	}
+}
@@ -0,0 +1,112 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+import { FileStats } from './common.js';
+
+/* opcodes of the binary tasks (must match env::detail::TaskOpcode) */
+export enum TaskOpcode {
+	loadCore = 0x01,
+	loadBlock = 0x02,
+	resolve = 0x10,
+	stats = 0x11,
+	path = 0x12,
+	list = 0x13,
+	accessed = 0x14,
+	changed = 0x15,
+	resize = 0x16,
+	create = 0x17,
+	read = 0x18,
+	write = 0x19,
+	readPhysical = 0x1a,
+	writePhysical = 0x1b
+};
+
+/* layout of the request: [opcode: u32, size: u32, data: u64, args: u64[4]], and the
+*	stats-record: [id, size, atime_us, mtime_us: u64, owner, group, name-size, link-size: u32, permissions: u16, type: u8] */
+const RequestSize = 48;
+const StatsSize = 56;
+const RangeSize = 16;
+const FileTypes = ['file', 'dir', 'link'];
+
+/* decoded binary task (ptr/size reference the buffer in the main memory, text and ranges are decoded from it depending on the opcode) */
+export interface TaskRequest {
+	opcode: TaskOpcode;
+	args: number[];
+	ptr: number;
+	size: number;
+	text: string;
+	ranges: [number, number][];
+}
+
+/* decode the request from the main memory (must be performed immediately, as the request is only valid for the duration of the import-call) */
+export function DecodeTask(memory: ArrayBuffer, ptr: number): TaskRequest {
+	let view = new DataView(memory, ptr, RequestSize);
+	let task: TaskRequest = { opcode: view.getUint32(0, true), size: view.getUint32(4, true), ptr: Number(view.getBigUint64(8, true)), args: [], text: '', ranges: [] };
+	for (let i = 0; i < 4; ++i)
+		task.args.push(Number(view.getBigUint64(16 + i * 8, true)));
+
+	/* decode the opcode-specific data */
+	if (task.opcode == TaskOpcode.resolve || task.opcode == TaskOpcode.stats || task.opcode == TaskOpcode.create)
+		task.text = new TextDecoder('utf-8').decode(new Uint8Array(memory, task.ptr, task.size));
+	else if (task.opcode == TaskOpcode.readPhysical || task.opcode == TaskOpcode.writePhysical) {
+		let ranges = new DataView(memory, task.ptr, task.size);
+		for (let i = 0; i + RangeSize <= task.size; i += RangeSize)
+			task.ranges.push([Number(ranges.getBigUint64(i, true)), Number(ranges.getBigUint64(i + 8, true))]);
+	}
+	return task;
+}
+
+function EncodeStats(records: [string, FileStats][], count: boolean): Uint8Array {
+	let encoder = new TextEncoder();
+	let strings = records.map(([name, stats]) => [encoder.encode(name), encoder.encode(stats.link)]);
+
+	/* compute the total size of the records (each padded to eight bytes) */
+	let total = (count ? 8 : 0);
+	for (const [name, link] of strings)
+		total += (StatsSize + name.length + link.length + 7) & ~7;
+
+	/* write the optional count and the records out */
+	let out = new Uint8Array(total);
+	let view = new DataView(out.buffer);
+	let offset = 0;
+	if (count) {
+		view.setBigUint64(0, BigInt(records.length), true);
+		offset = 8;
+	}
+	for (let i = 0; i < records.length; ++i) {
+		let stats = records[i][1], [name, link] = strings[i];
+		view.setBigUint64(offset, BigInt(stats.id), true);
+		view.setBigUint64(offset + 8, BigInt(stats.size), true);
+		view.setBigUint64(offset + 16, BigInt(Math.floor(stats.atime_us)), true);
+		view.setBigUint64(offset + 24, BigInt(Math.floor(stats.mtime_us)), true);
+		view.setUint32(offset + 32, stats.owner, true);
+		view.setUint32(offset + 36, stats.group, true);
+		view.setUint32(offset + 40, name.length, true);
+		view.setUint32(offset + 44, link.length, true);
+		view.setUint16(offset + 48, stats.permissions, true);
+		view.setUint8(offset + 50, FileTypes.indexOf(stats.type));
+		out.set(name, offset + StatsSize);
+		out.set(link, offset + StatsSize + name.length);
+		offset += (StatsSize + name.length + link.length + 7) & ~7;
+	}
+	return out;
+}
+function EncodeValue(value: number): Uint8Array {
+	let out = new Uint8Array(8);
+	new DataView(out.buffer).setBigUint64(0, BigInt(value), true);
+	return out;
+}
+
+/* encode the result of a file-system task as binary response (null is returned as empty response) */
+export function EncodeTaskResponse(opcode: TaskOpcode, value: any): Uint8Array | null {
+	if (opcode == TaskOpcode.accessed || opcode == TaskOpcode.changed || opcode == TaskOpcode.resize)
+		return EncodeValue(value ? 1 : 0);
+	if (value == null)
+		return null;
+	if (opcode == TaskOpcode.resolve || opcode == TaskOpcode.stats)
+		return EncodeStats([['', value]], false);
+	if (opcode == TaskOpcode.list)
+		return EncodeStats(Object.entries(value), true);
+	if (opcode == TaskOpcode.path)
+		return new TextEncoder().encode(value);
+	return EncodeValue(value);
+}
@@ -2,6 +2,8 @@
 /* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
 import { HostEnvironment, LogType } from './common.js';
 import { FileSystem } from './filesystem.js';
+import { SyncFileClient, DispatchFileTask } from './sync-filesystem.js';
+import { TaskOpcode, DecodeTask, EncodeTaskResponse } from './task-protocol.js';
 
 class EmptyError extends Error { constructor(m: string) { super(m); this.name = ''; } }
 
@@ -32,25 +34,129 @@ class BusyResolver {
 	}
 }
 
+class CompiledModule {
+	public bytes: Uint8Array;
+	public module: WebAssembly.Module;
+
+	public constructor(bytes: Uint8Array, module: WebAssembly.Module) {
+		this.bytes = bytes;
+		this.module = module;
+	}
+}
+
+/* process-wide registry of compiled modules (cores and blocks), keyed by their content, as the
+*	produced modules only depend on the translated guest-code, which allows multiple wasmlator
+*	instances (or workers after adopting the entries of another registry) to skip recompilations */
+class ModuleRegistry {
+	private static readonly MaxTotalBytes = 256 * 1024 * 1024;
+	private modules: Map<string, CompiledModule[]>;
+	private totalBytes: number;
+	public compiled: number;
+	public reused: number;
+
+	public constructor() {
+		this.modules = new Map<string, CompiledModule[]>();
+		this.totalBytes = 0;
+		this.compiled = 0;
+		this.reused = 0;
+	}
+
+	private static makeKey(bytes: Uint8Array): string {
+		/* FNV-1a over the module-bytes (collisions are resolved by comparing the full bytes) */
+		let hash = 0x811c9dc5;
+		for (let i = 0; i < bytes.length; ++i)
+			hash = Math.imul(hash ^ bytes[i], 0x01000193);
+		return `${bytes.length}:${(hash >>> 0).toString(16)}`;
+	}
+	private static matches(a: Uint8Array, b: Uint8Array): boolean {
+		if (a.length != b.length)
+			return false;
+		for (let i = 0; i < a.length; ++i) {
+			if (a[i] != b[i])
+				return false;
+		}
+		return true;
+	}
+
+	public lookup(bytes: Uint8Array): WebAssembly.Module | null {
+		let list = this.modules.get(ModuleRegistry.makeKey(bytes));
+		if (list === undefined)
+			return null;
+		for (const entry of list) {
+			if (ModuleRegistry.matches(entry.bytes, bytes))
+				return entry.module;
+		}
+		return null;
+	}
+	public insert(bytes: Uint8Array, module: WebAssembly.Module): void {
+		if (this.lookup(bytes) != null)
+			return;
+
+		/* evict the oldest entries until the new module fits into the budget */
+		while (this.totalBytes + bytes.length > ModuleRegistry.MaxTotalBytes && this.modules.size > 0) {
+			let [key, list] = this.modules.entries().next().value!;
+			this.modules.delete(key);
+			for (const entry of list)
+				this.totalBytes -= entry.bytes.length;
+		}
+
+		/* register the new module */
+		let key = ModuleRegistry.makeKey(bytes);
+		let list = this.modules.get(key);
+		if (list === undefined)
+			this.modules.set(key, [new CompiledModule(bytes, module)]);
+		else
+			list.push(new CompiledModule(bytes, module));
+		this.totalBytes += bytes.length;
+	}
+	public async compile(host: HostEnvironment, buffer: ArrayBuffer): Promise<WebAssembly.Module> {
+		let bytes = new Uint8Array(buffer);
+
+		/* check if the module has already been compiled */
+		let module = this.lookup(bytes);
+		if (module != null) {
+			++this.reused;
+			return module;
+		}
+
+		/* compile the module and register it */
+		module = await host.compileModule(buffer);
+		++this.compiled;
+		this.insert(bytes, module);
+		return module;
+	}
+	public entries(): CompiledModule[] {
+		let out: CompiledModule[] = [];
+		for (const list of this.modules.values())
+			out.push(...list);
+		return out;
+	}
+}
+const SharedModules: ModuleRegistry = new ModuleRegistry();
+
 class WasmLator {
 	private busy: BusyResolver;
 	private host: HostEnvironment;
 	private fs: FileSystem;
+	private syncFs: SyncFileClient | null;
 	private glue: { memory: WebAssembly.Memory, exports: WebAssembly.Exports };
 	private main: { memory: WebAssembly.Memory, exports: WebAssembly.Exports };
 	private guestMemory: WebAssembly.Memory;
 	private inputBuffer: string;
+	private outputDecoder: TextDecoder;
 	private profiler: Profiler;
 	private taskResolvable: (fn: (() => void) | null) => void;
 
-	public constructor(host: HostEnvironment) {
+	public constructor(host: HostEnvironment, syncFs: SyncFileClient | null) {
 		this.host = host;
 		this.fs = new FileSystem(host);
+		this.syncFs = syncFs;
 		this.busy = new BusyResolver();
 		this.glue = { memory: new WebAssembly.Memory({ initial: 0 }), exports: {} };
 		this.main = { memory: new WebAssembly.Memory({ initial: 0 }), exports: {} };
 		this.guestMemory = new WebAssembly.Memory({ initial: 0 });
 		this.inputBuffer = '';
+		this.outputDecoder = new TextDecoder('utf-8');
 		this.profiler = new Profiler();
 		this.taskResolvable = function (_) { };
 	}
@@ -138,9 +244,17 @@ class WasmLator {
 		imports.env.host_task = function (ptr: number, size: number, process: number): void {
 			_that.handleTask(_that.loadString(ptr, size, true), process);
 		};
+		imports.env.host_binary_task = function (ptr: number, process: number): void {
+			_that.handleBinaryTask(ptr, process);
+		};
 		imports.env.host_message = function (ptr: number, size: number): void {
 			_that.logGuest(_that.loadString(ptr, size, true));
 		};
+		imports.env.host_output = function (ptr: number, size: number): void {
+			/* decode the bulk of terminal output directly from the main memory (streamed, as
+			*	multi-byte characters might be split across flushes) and pass it out as a whole */
+			_that.host.log(LogType.output, _that.outputDecoder.decode(new Uint8Array(_that.main.memory.buffer, ptr, size), { stream: true }));
+		};
 		imports.env.host_failure = function (ptr: number, size: number): void {
 			_that.logGuest(new EmptyError(_that.loadString(ptr, size, true)).stack!);
 		};
@@ -148,22 +262,15 @@ class WasmLator {
 		imports.env.host_time_us = function (): bigint { return BigInt(Date.now() * 1000); };
 		imports.env.host_timezone_min = function (): number { return new Date().getTimezoneOffset(); };
 		imports.env.host_check_metrics = function (): void { _that.profiler.checkMemory(); };
+		imports.env.host_perf_map = function (): number { return (_that.host.perfSymbol === undefined ? 0 : 1); };
+		imports.env.host_perf_symbol = function (ptr: number, size: number): void {
+			let entry = _that.loadString(ptr, size, true), i = entry.indexOf(' ');
+			_that.host.perfSymbol?.(entry.substring(0, i), entry.substring(i + 1));
+		};
 		return imports;
 	}
 
-	private prepareTaskArgs(payload: string, n: number): [number[], string] {
-		let split: string[] = payload.split(':');
-		let args: number[] = [];
-		let rest: string = '';
-		for (let i = 0; i <= n; ++i) {
-			if (i < n)
-				args.push(parseInt(split[i]));
-			else if (i < split.length)
-				rest = split.slice(n).join(':');
-		}
-		return [args, rest];
-	}
-	private async handleTask(task: String, process: number) {
+	private async handleTask(task: string, process: number) {
 		/* stop the profiler and enter the critical section - will be left by the task-completed callback */
 		this.profiler.pause();
 		this.busy.enter();
@@ -175,67 +282,8 @@ class WasmLator {
 			payload = task.substring(i + 1);
 		}
 
-		/* handle the core and block creation handling */
-		if (cmd == 'core') {
-			this.profiler.startLoad();
-			let [args, _] = this.prepareTaskArgs(payload, 2);
-			this.loadCore(this.loadBuffer(args[0], args[1]), process);
-		}
-		else if (cmd == 'block') {
-			this.profiler.startLoad();
-			let [args, _] = this.prepareTaskArgs(payload, 2);
-			this.loadBlock(this.loadBuffer(args[0], args[1]), process);
-		}
-
-		/* handle the file-system commands */
-		else if (cmd.startsWith('resolve')) {
-			this.profiler.startFileSystem();
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.getNode(payload)));
-		}
-		else if (cmd == 'stats') {
-			this.profiler.startFileSystem();
-			let [args, name] = this.prepareTaskArgs(payload, 1);
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.getStats(args[0], name)));
-		}
-		else if (cmd.startsWith('path')) {
-			this.profiler.startFileSystem();
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.getPath(parseInt(payload))));
-		}
-		else if (cmd == 'accessed') {
-			this.profiler.startFileSystem();
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.setRead(parseInt(payload))));
-		}
-		else if (cmd == 'changed') {
-			this.profiler.startFileSystem();
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.setWritten(parseInt(payload))));
-		}
-		else if (cmd == 'resize') {
-			this.profiler.startFileSystem();
-			let [args, _] = this.prepareTaskArgs(payload, 2);
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.fileResize(args[0], args[1])));
-		}
-		else if (cmd == 'read') {
-			this.profiler.startFileSystem();
-			let [args, _] = this.prepareTaskArgs(payload, 4);
-			let buf = new Uint8Array(this.main.memory.buffer, args[1], args[3]);
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.fileRead(args[0], buf, args[2])));
-		}
-		else if (cmd == 'write') {
-			this.profiler.startFileSystem();
-			let [args, _] = this.prepareTaskArgs(payload, 4);
-			let buf = new Uint8Array(this.main.memory.buffer, args[1], args[3]);
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.fileWrite(args[0], buf, args[2])));
-		}
-		else if (cmd == 'create') {
-			this.profiler.startFileSystem();
-			let [args, rest] = this.prepareTaskArgs(payload, 4);
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.fileCreate(args[0], rest, args[1], args[2], args[3])));
-		}
-		else if (cmd == 'list') {
-			this.profiler.startFileSystem();
-			this.taskResolvable(async () => this.taskCompleted(process, await this.fs.directoryRead(parseInt(payload))));
-		}
-		else if (cmd == 'input') {
+		/* handle the input-command */
+		if (cmd == 'input') {
 			/* check if new data need to be fetched */
 			if (this.inputBuffer.length == 0)
 				this.inputBuffer = await this.host.readInput();
@@ -243,23 +291,58 @@ class WasmLator {
 			/* fetch as many data as possible from the input buffer */
 			let actual = this.inputBuffer.substring(0, parseInt(payload));
 			this.inputBuffer = this.inputBuffer.substring(actual.length);
-			this.taskResolvable(async () => this.taskCompleted(process, actual, true));
+			this.taskResolvable(async () => this.taskCompleted(process, actual));
 		}
 
 		/* default catch-handler for unknown commands */
 		else
 			this.errSelf(new EmptyError(`Received unknown task [${cmd}]`).stack!);
 	}
-	private taskCompleted(process: number, payload?: any, rawString?: boolean): void {
+	private handleBinaryTask(ptr: number, process: number): void {
+		/* stop the profiler and enter the critical section - will be left by the task-completed callback */
+		this.profiler.pause();
+		this.busy.enter();
+
+		/* decode the request immediately, as it only remains valid for the duration of the import-call */
+		let task = DecodeTask(this.main.memory.buffer, ptr);
+
+		/* handle the core and block creation handling */
+		if (task.opcode == TaskOpcode.loadCore || task.opcode == TaskOpcode.loadBlock) {
+			this.profiler.startLoad();
+			if (task.opcode == TaskOpcode.loadCore)
+				this.loadCore(this.loadBuffer(task.ptr, task.size), process);
+			else
+				this.loadBlock(this.loadBuffer(task.ptr, task.size), process);
+			return;
+		}
+
+		/* handle the file-system tasks synchronously, if a channel exists (completes the task in-place without unwinding the execution) */
+		let sync = (this.syncFs == null ? null : this.syncFs.perform(task, this.main.memory.buffer, this.guestMemory.buffer));
+		if (sync != null) {
+			this.profiler.startFileSystem();
+			this.taskCompleted(process, EncodeTaskResponse(task.opcode, sync.value));
+			return;
+		}
+
+		/* handle the file-system tasks */
+		let fsTask = DispatchFileTask(this.fs, task, (ptr, size) => new Uint8Array(this.main.memory.buffer, ptr, size), (ptr, size) => new Uint8Array(this.guestMemory.buffer, ptr, size));
+		if (fsTask == null) {
+			this.errSelf(new EmptyError(`Received unknown task opcode [${task.opcode}]`).stack!);
+			return;
+		}
+		this.profiler.startFileSystem();
+		this.taskResolvable(async () => this.taskCompleted(process, EncodeTaskResponse(task.opcode, await fsTask!())));
+	}
+	private taskCompleted(process: number, payload?: Uint8Array | string | null): void {
 		this.profiler.startExecute();
 
-		/* write the result to the main application */
+		/* write the result to the main application (strings are passed as raw text, null as empty response) */
 		let addr = 0, size = 0;
-		if (payload != null) {
-			let buffer = new TextEncoder().encode(rawString ? payload : JSON.stringify(payload));
+		if (payload != null && payload.length > 0) {
+			let buffer = (typeof payload == 'string' ? new TextEncoder().encode(payload) : payload);
 			addr = (this.main.exports.main_allocate as (_: number) => number)(buffer.byteLength);
 			size = buffer.byteLength;
-			new Uint8Array(this.main.memory.buffer, addr, size).set(new Uint8Array(buffer));
+			new Uint8Array(this.main.memory.buffer, addr, size).set(buffer);
 		}
 
 		/* invoke the callback and mark the critical section (opened by handle-task) as completed */
@@ -298,9 +381,13 @@ class WasmLator {
 		imports.glue = { ...this.glue.exports };
 		imports.main = { ...this.main.exports };
 
+		/* pass the host-time through to the core, to allow the blocks to read the clock without entering the main module */
+		imports.host = { host_time_us: function (): bigint { return BigInt(Date.now() * 1000); } };
+
 		try {
-			/* load the module */
-			let instance: WebAssembly.Instance = await this.host.loadModule(imports, buffer);
+			/* load the module (reuse any already compiled instance of the same core) */
+			let module: WebAssembly.Module = await SharedModules.compile(this.host, buffer);
+			let instance: WebAssembly.Instance = await WebAssembly.instantiate(module, imports);
 			this.guestMemory = (instance.exports.memory_physical as WebAssembly.Memory);
 
 			/* set the last-instance, invoke the handler, and then reset the last-instance
@@ -324,8 +411,9 @@ class WasmLator {
 		let imports: WebAssembly.Imports = (this.glue.exports.get_imports as () => WebAssembly.Imports)();
 
 		try {
-			/* load the module */
-			let instance: WebAssembly.Instance = await this.host.loadModule(imports, buffer);
+			/* load the module (reuse any already compiled instance of the same block) */
+			let module: WebAssembly.Module = await SharedModules.compile(this.host, buffer);
+			let instance: WebAssembly.Instance = await WebAssembly.instantiate(module, imports);
 
 			/* set the last-instance, invoke the handler, and then reset the last-instance
 			*	again, in order to ensure unused instances can be garbage-collected */
@@ -583,6 +671,7 @@ class Profiler {
 class PerfoStats {
 	public mem: { total: number; filesystem: number; wasmlator: number; guest: number };
 	public time: { total: number; startup: number, filesystem: number; executing: number; compilation: number };
+	public modules: { compiled: number; reused: number };
 
 	public constructor(fs: FileSystem, main: ArrayBuffer, glue: ArrayBuffer, guest: ArrayBuffer, profiler: Profiler) {
 		this.time = {
@@ -600,6 +689,12 @@ class PerfoStats {
 			wasmlator: main.byteLength + glue.byteLength,
 			guest: guest.byteLength
 		};
+
+		/* setup the process-wide module compilation counters */
+		this.modules = {
+			compiled: SharedModules.compiled,
+			reused: SharedModules.reused
+		};
 	}
 }
 
@@ -621,8 +716,20 @@ class Interactable {
 	}
 }
 
-export async function SetupWasmlator(host: HostEnvironment): Promise<Interactable | null> {
-	let wasmlator: WasmLator = new WasmLator(host);
+/* fetch all compiled modules of this process (can be posted to workers) */
+export function ShareCompiledModules(): CompiledModule[] {
+	return SharedModules.entries();
+}
+
+/* register compiled modules received from another process or worker */
+export function AdoptCompiledModules(modules: CompiledModule[]): void {
+	for (const entry of modules)
+		SharedModules.insert(entry.bytes, entry.module);
+}
+
+/* setup a new wasmlator instance (file-system tasks are performed synchronously through the channel, if passed) */
+export async function SetupWasmlator(host: HostEnvironment, syncFs?: SyncFileClient): Promise<Interactable | null> {
+	let wasmlator: WasmLator = new WasmLator(host, syncFs ?? null);
 	if (!await wasmlator.prepareAndLoadMain())
 		return null;
 	return new Interactable(wasmlator);
@@ -1,8 +1,11 @@
 /* SPDX-License-Identifier: BSD-3-Clause */
 /* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
-import { realpathSync, promises as fs } from 'fs';
+import { realpathSync, readFileSync, writeFileSync, promises as fs } from 'fs';
 import * as filePath from 'path';
 
+/* maximum number of file handles kept open for reading ranges (least recently used handles are closed first) */
+const MaxOpenHandles = 64;
+
 export class NodeHost {
 	constructor(reader, root, wasm, impFileStats, impLogType) {
 		this._reader = reader;
@@ -11,6 +14,8 @@ export class NodeHost {
 		this._lastOpenLine = false;
 		this._impFileStats = impFileStats;
 		this._impLogType = impLogType;
+		this._handles = new Map();
+		this._perfSymbols = null;
 	}
 
 	_makeRealPath(path) {
@@ -89,6 +94,36 @@ export class NodeHost {
 		return link;
 	}
 
+	enablePerfMap() {
+		/* only define the symbol-callback once enabled, as its existence enables the symbolization of the translated blocks */
+		this._perfSymbols = new Map();
+		this.perfSymbol = function (name, symbol) {
+			this._perfSymbols.set(name, symbol);
+		};
+	}
+	writePerfMap() {
+		/* the map itself is written by v8 (requires node to run with --perf-basic-prof) and only lacks the guest
+		*	symbols of the translated blocks (performed synchronously, as it is written out on exit of the process) */
+		let path = `/tmp/perf-${process.pid}.map`, lines = null;
+		try {
+			lines = readFileSync(path, { encoding: 'utf-8' }).split('\n');
+		} catch (_) {
+			console.error(`error: perf-map [${path}] not found (node must be started with --perf-basic-prof)`);
+			return;
+		}
+
+		/* append the guest symbol to all entries of exported block-functions (entries are of the form [start size name]) */
+		for (let i = 0; i < lines.length; ++i) {
+			let match = lines[i].match(/addr_0x[0-9a-f]{16}/);
+			if (match == null || lines[i].includes(' [guest: '))
+				continue;
+			let symbol = this._perfSymbols.get(match[0]);
+			if (symbol != undefined)
+				lines[i] += ` [guest: ${symbol}]`;
+		}
+		writeFileSync(path, lines.join('\n'));
+	}
+
 	log(type, msg) {
 		/* check if its a normal output-log, which can simply be written to the stdout */
 		if (type == this._impLogType.output) {
@@ -115,10 +150,8 @@ export class NodeHost {
 		let instantiated = await WebAssembly.instantiate(data, imports);
 		return instantiated.instance;
 	}
-	async loadModule(imports, buffer) {
-		let module = await WebAssembly.compile(buffer);
-		let instance = await WebAssembly.instantiate(module, imports);
-		return instance;
+	async compileModule(buffer) {
+		return await WebAssembly.compile(buffer);
 	}
 	async readInput() {
 		let _that = this;
@@ -128,12 +161,7 @@ export class NodeHost {
 			});
 		});
 	}
-	async fsLoadStats(path) {
-		/* validate the filepath */
-		var [actual, parts] = await this._validatePath(path);
-		if (actual == null)
-			return null;
-
+	async _loadStats(actual, parts) {
 		/* read the stats of the path */
 		let stats = null;
 		try {
@@ -178,29 +206,89 @@ export class NodeHost {
 			return null;
 		return out;
 	}
-	async fsLoadData(path) {
+	async fsLoadStats(path) {
 		/* validate the filepath */
+		var [actual, parts] = await this._validatePath(path);
+		if (actual == null)
+			return null;
+		return await this._loadStats(actual, parts);
+	}
+	async _openFile(path) {
 		var [actual, _] = await this._validatePath(path);
 		if (actual == null)
 			throw new Error(`Invalid path [${path}] encountered`);
 		let stats = await fs.lstat(actual);
 		if (stats.isSymbolicLink() || !stats.isFile())
 			throw new Error(`Invalid file [${path}] encountered`);
+		return await fs.open(actual, 'r');
+	}
+	_closeHandle(entry) {
+		entry.handle.then((handle) => handle.close(), () => { });
+	}
+	_acquireHandle(path) {
+		/* reuse the opened or currently opening handle of the path (reinserted to mark it as most recently used) */
+		let entry = this._handles.get(path);
+		if (entry !== undefined)
+			this._handles.delete(path);
+		else {
+			/* register the handle before it has been opened, to ensure concurrent reads share it (failed opens are dropped again) */
+			entry = { handle: this._openFile(path), users: 0, evicted: false };
+			entry.handle.catch(() => {
+				if (this._handles.get(path) === entry)
+					this._handles.delete(path);
+			});
+		}
+		this._handles.set(path, entry);
+		++entry.users;
 
-		/* read the content of the file */
-		return new Uint8Array(await fs.readFile(actual));
+		/* evict the least recently used handles (closed once their last read has completed) */
+		while (this._handles.size > MaxOpenHandles) {
+			let [oldPath, oldEntry] = this._handles.entries().next().value;
+			this._handles.delete(oldPath);
+			oldEntry.evicted = true;
+			if (oldEntry.users == 0)
+				this._closeHandle(oldEntry);
+		}
+		return entry;
 	}
-	async fsLoadChildren(path) {
+	_releaseHandle(entry) {
+		if (--entry.users == 0 && entry.evicted)
+			this._closeHandle(entry);
+	}
+	async fsLoadRange(path, offset, size) {
+		/* keep the file open for all upcoming ranges */
+		let entry = this._acquireHandle(path);
+		try {
+			/* read the range of the file (might be shorter, if the end of the file has been reached) */
+			let handle = await entry.handle;
+			let buffer = new Uint8Array(size);
+			let result = await handle.read(buffer, 0, size, offset);
+			return buffer.subarray(0, result.bytesRead);
+		}
+		finally {
+			this._releaseHandle(entry);
+		}
+	}
+	async fsLoadChildrenWithStats(path) {
 		/* validate the filepath */
-		var [actual, _] = await this._validatePath(path);
+		var [actual, parts] = await this._validatePath(path);
 		if (actual == null)
 			throw new Error(`Invalid path [${path}] encountered`);
 		let stats = await fs.lstat(actual);
 		if (stats.isSymbolicLink() || !stats.isDirectory())
 			throw new Error(`Invalid directory [${path}] encountered`);
 
-		/* read the content of the file and sanitize it */
-		let list = await fs.readdir(actual);
-		return list.filter((v) => !['', '.', '..'].includes(v));
+		/* read the children and skip any invalid names or unsupported types without fetching their stats */
+		let list = (await fs.readdir(actual, { withFileTypes: true })).filter((v) => !['', '.', '..'].includes(v.name)
+			&& (v.isFile() || v.isDirectory() || v.isSymbolicLink()));
+
+		/* fetch the stats of all children in parallel (children with invalid stats are dropped) */
+		let children = await Promise.all(list.map((v) => this._loadStats(filePath.join(actual, v.name), [...parts, v.name])));
+		let out = {};
+		for (let i = 0; i < list.length; ++i) {
+			if (children[i] != null)
+				out[list[i].name] = children[i];
+		}
+		return out;
 	}
 }
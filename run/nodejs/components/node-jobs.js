@@ -0,0 +1,236 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+import { Worker, isMainThread, parentPort, workerData } from 'worker_threads';
+import { availableParallelism } from 'os';
+import { NodeHost } from './node-host.js';
+
+/* host of a single worker, which collects the guest output per job instead of writing it directly */
+class JobHost extends NodeHost {
+	constructor(root, wasm, impFileStats, impLogType) {
+		super(null, root, wasm, impFileStats, impLogType);
+		this._output = '';
+		this._errors = '';
+	}
+
+	log(type, msg) {
+		if (type == this._impLogType.output)
+			this._output += msg;
+		else if (type == this._impLogType.fatal || type == this._impLogType.errInternal)
+			this._errors += msg;
+	}
+	async readInput() {
+		/* jobs do not have any interactive input */
+		return '';
+	}
+	takeOutput() {
+		let out = [this._output, this._errors];
+		this._output = '';
+		this._errors = '';
+		return out;
+	}
+}
+
+/* worker-side: load a separate wasmlator instance and execute the jobs one at a time */
+async function RunWorker(config) {
+	const { FileStats, LogType } = await import(config.common + '/common.js');
+	const { SetupWasmlator, ShareCompiledModules, AdoptCompiledModules } = await import(config.common + '/wasmlator.js');
+	const { SyncFileClient } = await import(config.common + '/sync-filesystem.js');
+	let host = new JobHost(config.root, config.wasm, FileStats, LogType);
+
+	/* adopt the modules already compiled by the other workers and keep track of the modules known to the pool */
+	let shared = new WeakSet();
+	let adopt = function (modules) {
+		AdoptCompiledModules(modules);
+		for (const entry of ShareCompiledModules())
+			shared.add(entry);
+	};
+	adopt(config.modules);
+
+	/* check if the file-system tasks should be performed synchronously by the parent (notified through a message) */
+	let syncFs = undefined;
+	if (config.channel != null)
+		syncFs = new SyncFileClient(config.channel, () => parentPort.postMessage({ type: 'sync' }));
+	let wasmlator = await SetupWasmlator(host, syncFs);
+	if (wasmlator == null) {
+		parentPort.postMessage({ type: 'failed', errors: host.takeOutput()[1] });
+		return;
+	}
+	parentPort.postMessage({ type: 'ready' });
+
+	/* the statistics of the wasmlator accumulate across executions, therefore only pass the differences of each job */
+	let last = wasmlator.stats();
+	let delta = function (stats) {
+		let out = { mem: stats.mem, time: {}, modules: {} };
+		for (const key in stats.time)
+			out.time[key] = stats.time[key] - last.time[key];
+		for (const key in stats.modules)
+			out.modules[key] = stats.modules[key] - last.modules[key];
+		last = stats;
+		return out;
+	};
+
+	parentPort.on('message', async function (msg) {
+		if (msg.type == 'close') {
+			parentPort.close();
+			return;
+		}
+
+		/* adopt the modules compiled by the other workers in the meantime */
+		adopt(msg.modules);
+
+		/* execute the job and pass the collected output, statistics, and newly compiled modules back */
+		let start = Date.now();
+		await wasmlator.execute(msg.command);
+		let [output, errors] = host.takeOutput();
+		let modules = ShareCompiledModules().filter((entry) => !shared.has(entry));
+		for (const entry of modules)
+			shared.add(entry);
+		parentPort.postMessage({ type: 'done', id: msg.id, output: output, errors: errors, stats: delta(wasmlator.stats()), duration: (Date.now() - start) / 1000, modules: modules });
+	});
+}
+if (!isMainThread && workerData != null && workerData.wasmlatorJobs)
+	await RunWorker(workerData);
+
+/* job-runner, which distributes the queued commands across a pool of workers, each with its own glue/main/core instances
+*	Note: with synchronous io, the file-system of each worker is owned by this thread, while the worker blocks on the shared channel
+*	Note: modules compiled by any worker are collected after each job and passed to the other workers with their next job */
+export class JobRunner {
+	constructor(root, wasm, common, count, syncIO) {
+		this._config = { wasmlatorJobs: true, root: root, wasm: wasm, common: common, channel: null, modules: [] };
+		this._modules = [];
+		this._count = Math.max(1, count ?? availableParallelism());
+		this._syncIO = (syncIO ?? false);
+	}
+
+	async _spawn() {
+		let config = { ...this._config, modules: this._modules.map((shared) => shared.entry) };
+
+		/* setup the file-system server for the worker */
+		let server = null;
+		if (this._syncIO) {
+			const { FileStats, LogType } = await import(config.common + '/common.js');
+			const { SyncFileServer, CreateSyncChannel } = await import(config.common + '/sync-filesystem.js');
+			config = { ...config, channel: CreateSyncChannel() };
+			server = new SyncFileServer(new NodeHost(null, config.root, config.wasm, FileStats, LogType), config.channel);
+		}
+
+		let worker = new Worker(new URL(import.meta.url), { workerData: config });
+		if (server != null)
+			worker.on('message', function (msg) {
+				if (msg.type == 'sync')
+					server.handle();
+			});
+		return new Promise(function (resolve, reject) {
+			let cleanup = function () {
+				worker.off('message', setup);
+				worker.off('error', failed);
+				worker.off('exit', exited);
+			};
+			let setup = function (msg) {
+				if (msg.type == 'sync')
+					return;
+				cleanup();
+				if (msg.type == 'ready')
+					resolve(worker);
+				else
+					reject(new Error(`Failed to setup worker: ${msg.errors}`));
+			};
+			let failed = function (err) {
+				cleanup();
+				reject(err);
+			};
+			let exited = function (code) {
+				cleanup();
+				reject(new Error(`Worker exited with [${code}] during setup`));
+			};
+			worker.on('message', setup);
+			worker.on('error', failed);
+			worker.on('exit', exited);
+		});
+	}
+	_execute(worker, job, modules) {
+		/* pass the job to the worker and wait for it to complete (a worker, which fails or exits while executing the job, is terminated) */
+		return new Promise(function (resolve) {
+			let start = Date.now();
+			let cleanup = function () {
+				worker.off('message', done);
+				worker.off('error', failed);
+				worker.off('exit', exited);
+			};
+			let done = function (msg) {
+				if (msg.type != 'done')
+					return;
+				cleanup();
+				resolve({ output: msg.output, errors: msg.errors, stats: msg.stats, duration: msg.duration, modules: msg.modules, alive: true });
+			};
+			let abort = function (reason) {
+				cleanup();
+				worker.terminate();
+				resolve({ output: '', errors: `Worker failed while executing the job: ${reason}\n`, stats: EmptyStats(), duration: (Date.now() - start) / 1000, modules: [], alive: false });
+			};
+			let failed = function (err) { abort(err.stack ?? err); };
+			let exited = function (code) { abort(`exited with [${code}]`); };
+			worker.on('message', done);
+			worker.on('error', failed);
+			worker.on('exit', exited);
+			worker.postMessage({ type: 'job', id: job.id, command: job.command, modules: modules });
+		});
+	}
+	async _drain(queue, commands, results, completed) {
+		/* fetch the next job of the queue until all jobs have been processed (failed workers are respawned for the remaining jobs) */
+		let worker = null, synced = 0;
+		while (queue.length > 0) {
+			if (worker == null) {
+				synced = this._modules.length;
+				worker = await this._spawn();
+			}
+
+			/* pass the modules collected from the other workers since the last job of this worker along and collect the modules compiled by it */
+			let job = queue.shift(), origin = worker;
+			let modules = this._modules.slice(synced).filter((shared) => shared.origin !== origin).map((shared) => shared.entry);
+			synced = this._modules.length;
+			let result = await this._execute(worker, job, modules);
+			this._modules.push(...result.modules.map((entry) => ({ entry: entry, origin: origin })));
+			if (!result.alive)
+				worker = null;
+			results[job.id] = { command: commands[job.id], output: result.output, errors: result.errors, stats: result.stats, duration: result.duration };
+			completed(results[job.id]);
+		}
+		if (worker != null)
+			worker.postMessage({ type: 'close' });
+	}
+
+	/* execute all commands and invoke the callback for every completed job (in completion-order) */
+	async run(commands, completed) {
+		let queue = commands.map((c, i) => ({ id: i, command: c }));
+		let results = new Array(commands.length);
+
+		/* setup the worker pool (no more workers than jobs) and let each worker drain the shared queue */
+		let count = Math.min(this._count, queue.length);
+		await Promise.all(Array.from({ length: count }, () => this._drain(queue, commands, results, completed)));
+		return results;
+	}
+}
+
+/* statistics of a job, which did not complete */
+function EmptyStats() {
+	return {
+		mem: { total: 0, filesystem: 0, wasmlator: 0, guest: 0 },
+		time: { total: 0, startup: 0, filesystem: 0, executing: 0, compilation: 0 },
+		modules: { compiled: 0, reused: 0 }
+	};
+}
+
+/* aggregate the statistics of all jobs (times and modules are summed, memory is the peak of any single worker) */
+export function AggregateStats(results) {
+	let out = EmptyStats();
+	for (const result of results) {
+		for (const key in out.mem)
+			out.mem[key] = Math.max(out.mem[key], result.stats.mem[key]);
+		for (const key in out.time)
+			out.time[key] += result.stats.time[key];
+		for (const key in out.modules)
+			out.modules[key] += result.stats.modules[key];
+	}
+	return out;
+}
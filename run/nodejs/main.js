@@ -3,6 +3,7 @@
 import { NodeHost } from './{{self-exec-rel-path}}/node-host.js';
 import { FileStats, LogType } from './{{common-exec-rel-path}}/common.js';
 import { SetupWasmlator } from './{{common-exec-rel-path}}/wasmlator.js';
+import { JobRunner, AggregateStats } from './{{self-exec-rel-path}}/node-jobs.js';
 import { createInterface } from 'readline';
 import { promises as fs } from 'fs';
 import path from 'path';
@@ -21,11 +22,6 @@ try {
 	process.exit(1);
 }
 
-/* setup the io-reader, host, and load the wasmlator */
-let reader = createInterface({ input: process.stdin, output: process.stdout });
-let host = new NodeHost(reader, fsPath, './{{wasm-path}}', FileStats, LogType);
-let wasmlator = await SetupWasmlator(host);
-
 /* check if the application should be profiled */
 let profiling = false;
 if (process.argv.includes('--profile-wasmlator')) {
@@ -56,8 +52,63 @@ let printProfile = function (stats) {
 	console.log(`  Total      : ${out(stats.time.total)} sec`);
 	let misc = stats.time.total - stats.time.startup - stats.time.filesystem - stats.time.executing - stats.time.compilation;
 	console.log(`    Misc     : ${out(misc)} sec`);
+	console.log('\nModules:');
+	console.log(`  Compiled   : ${stats.modules.compiled.toString().padStart(12, ' ')}`);
+	console.log(`  Reused     : ${stats.modules.reused.toString().padStart(12, ' ')}`);
 };
 
+/* check if the translated blocks should be symbolized in the perf-map written by v8 (only for executions on the main thread) */
+let perfMap = false;
+if (process.argv.includes('--perf-map')) {
+	process.argv = process.argv.filter((v) => v != '--perf-map');
+	perfMap = true;
+}
+
+/* check if the file-system tasks should be performed synchronously (requires the execution to be moved into workers) */
+let syncIO = false;
+if (process.argv.includes('--sync-io')) {
+	process.argv = process.argv.filter((v) => v != '--sync-io');
+	syncIO = true;
+}
+
+/* check if a job-file should be executed by a pool of workers */
+let jobFile = null, workerCount = null;
+for (const arg of process.argv.slice(2)) {
+	if (arg.startsWith('--jobs='))
+		jobFile = arg.substring(7);
+	else if (arg.startsWith('--workers='))
+		workerCount = parseInt(arg.substring(10));
+}
+process.argv = process.argv.filter((v) => !v.startsWith('--jobs=') && !v.startsWith('--workers='));
+
+/* execute all jobs (one command per line) and print their output once completed (a single program with synchronous io is executed as single job) */
+if (jobFile != null || (syncIO && process.argv.length > 2)) {
+	let commands = [`"${process.argv.slice(2).join('" "')}"`];
+	if (jobFile != null)
+		commands = (await fs.readFile(jobFile, { encoding: 'utf-8' })).split('\n').map((v) => v.trim()).filter((v) => v.length > 0);
+	let runner = new JobRunner(fsPath, './{{wasm-path}}', new URL('./{{common-exec-rel-path}}', import.meta.url).href, workerCount, syncIO);
+	let start = Date.now();
+	let results = await runner.run(commands, function (result) {
+		console.log(`[job: ${result.command}] completed in ${result.duration.toFixed(3)} sec`);
+		if (result.output.length > 0)
+			process.stdout.write(result.output.endsWith('\n') ? result.output : result.output + '\n');
+		if (result.errors.length > 0)
+			process.stderr.write(result.errors);
+	});
+	console.log(`Executed [${results.length}] jobs in ${((Date.now() - start) / 1000).toFixed(3)} sec`);
+	printProfile(AggregateStats(results));
+	process.exit(0);
+}
+
+/* setup the io-reader, host, and load the wasmlator */
+let reader = createInterface({ input: process.stdin, output: process.stdout });
+let host = new NodeHost(reader, fsPath, './{{wasm-path}}', FileStats, LogType);
+if (perfMap) {
+	host.enablePerfMap();
+	process.on('exit', () => host.writePerfMap());
+}
+let wasmlator = await SetupWasmlator(host);
+
 /* check if a single program should be executed */
 if (process.argv.length > 2) {
 	await wasmlator.execute(`"${process.argv.slice(2).join('" "')}"`);
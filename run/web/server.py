@@ -110,13 +110,21 @@ class FileSystemInteract:
 		else:
 			return None
 		return out
-	def getList(self, path):
+	def getChildren(self, path):
 		base = (path if path == '/' else f'{path}/')
 		path, _ = self._validatePath(path)
 		if path is None or os.path.islink(path) or not os.path.isdir(path):
 			return None
-		
-		return [x for x in os.listdir(path) if x not in ['', '.', '..'] and self.getStats(base + x) is not None]
+
+		# fetch the stats of all children at once (children with invalid stats are dropped)
+		out = {}
+		for x in os.listdir(path):
+			if x in ['', '.', '..']:
+				continue
+			stats = self.getStats(base + x)
+			if stats is not None:
+				out[x] = stats
+		return out
 	def open(self, path):
 		path, _ = self._validatePath(path)
 		if path is None or os.path.islink(path) or not os.path.isfile(path):
@@ -155,19 +163,55 @@ class SelfRequest(http.server.SimpleHTTPRequestHandler):
 		if f is None:
 			super().send_error(http.HTTPStatus.NOT_FOUND, "File not found")
 			return None
-		super().send_response(http.HTTPStatus.OK)
-		super().send_header('Content-Length', f'{fileSystem.getSize(f)}')
+		size = fileSystem.getSize(f)
+
+		# check if only a range of the file has been requested (only single ranges of the form 'bytes=first-last' are supported)
+		first, last = 0, size - 1
+		range = self.headers.get('Range')
+		if range is not None and range.startswith('bytes=') and ',' not in range:
+			try:
+				start, end = range[6:].split('-')
+				first = int(start)
+				last = min(int(end) if end != '' else size - 1, size - 1)
+			except ValueError:
+				first, last = 0, size - 1
+				range = None
+		else:
+			range = None
+		count = max(last - first + 1, 0)
+
+		# check if the range cannot be satisfied (i.e. starts at or beyond the end of the file)
+		if range is not None and count == 0:
+			f.close()
+			super().send_response(http.HTTPStatus.REQUESTED_RANGE_NOT_SATISFIABLE)
+			super().send_header('Content-Range', f'bytes */{size}')
+			super().send_header('Content-Length', '0')
+			super().end_headers()
+			return None
+
+		# send the header and the data of the file or range
+		if range is None:
+			super().send_response(http.HTTPStatus.OK)
+		else:
+			super().send_response(http.HTTPStatus.PARTIAL_CONTENT)
+			super().send_header('Content-Range', f'bytes {first}-{first + count - 1}/{size}')
+		super().send_header('Content-Length', f'{count}')
 		super().send_header('Content-Type', 'application/binary')
 		super().end_headers()
 		if not body:
+			f.close()
 			return None
 		try:
-			super().copyfile(f, self.wfile)
+			if range is None:
+				super().copyfile(f, self.wfile)
+			else:
+				f.seek(first)
+				self.wfile.write(f.read(count))
 		finally:
 			f.close()
 	def do_list(self, body, path):
-		list = fileSystem.getList(path)
-		out = json.dumps(list).encode('utf-8')
+		children = fileSystem.getChildren(path)
+		out = json.dumps(children).encode('utf-8')
 		super().send_response(http.HTTPStatus.OK)
 		super().send_header('Content-Length', f'{len(out)}')
 		super().send_header('Content-Type', 'application/json; charset=utf-8')
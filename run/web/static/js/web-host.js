@@ -22,20 +22,13 @@ export class WebHost {
 		let instantiated = await WebAssembly.instantiateStreaming(response, imports);
 		return instantiated.instance;
 	}
-	async loadModule(imports, buffer) {
-		let module = await WebAssembly.compile(buffer);
-		let instance = await WebAssembly.instantiate(module, imports);
-		return instance;
+	async compileModule(buffer) {
+		return await WebAssembly.compile(buffer);
 	}
 	async readInput() {
 		return (await this._userInput()) + '\n';
 	}
-	async fsLoadStats(path) {
-		let response = await fetch(`/stat${path}`, { credentials: 'same-origin' });
-		let json = await response.json();
-		if (json == null)
-			return null;
-
+	_parseStats(json) {
 		/* populate the filestats with the values received from the remote */
 		let stats = new FileStats(json.type);
 		stats.link = json.link;
@@ -44,15 +37,42 @@ export class WebHost {
 		stats.mtime_us = json.mtime_us;
 		return stats;
 	}
-	async fsLoadData(path) {
-		let response = await fetch(`/data${path}`, { credentials: 'same-origin' });
-		return new Uint8Array(await response.arrayBuffer());
+	async fsLoadStats(path) {
+		let response = await fetch(`/stat${path}`, { credentials: 'same-origin' });
+		let json = await response.json();
+		if (json == null)
+			return null;
+		return this._parseStats(json);
 	}
-	async fsLoadChildren(path) {
+	async fsLoadRange(path, offset, size) {
+		if (size == 0)
+			return new Uint8Array(0);
+		let response = await fetch(`/data${path}`, { credentials: 'same-origin', headers: { 'Range': `bytes=${offset}-${offset + size - 1}` } });
+
+		/* check if the range starts at or beyond the end of the file */
+		if (response.status == 416)
+			return new Uint8Array(0);
+		if (!response.ok)
+			throw new Error(`Failed to fetch range of [${path}]`);
+		let data = new Uint8Array(await response.arrayBuffer());
+
+		/* check if the server ignored the range and returned the entire file */
+		if (response.status != 206)
+			return data.subarray(offset, offset + size);
+		return data;
+	}
+	async fsLoadChildrenWithStats(path) {
 		let response = await fetch(`/list${path}`, { credentials: 'same-origin' });
 		let json = await response.json();
+		if (json == null)
+			throw new Error(`Invalid directory [${path}] encountered`);
 
-		/* read the content of the file and sanitize it */
-		return json.filter((v) => !['', '.', '..'].includes(v));
+		/* parse the stats of all children and sanitize their names */
+		let out = {};
+		for (const name in json) {
+			if (!['', '.', '..'].includes(name))
+				out[name] = this._parseStats(json[name]);
+		}
+		return out;
 	}
 }
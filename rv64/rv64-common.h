@@ -6,6 +6,8 @@
 #include <cinttypes>
 #include <memory>
 #include <vector>
+#include <cmath>
+#include <bit>
 
 #include "../system/system.h"
 
@@ -440,6 +442,14 @@ namespace rv64 {
 		static constexpr uint16_t dynamicRounding = 0x07;
 	}
 
+	namespace fflags {
+		static constexpr uint64_t inexact = 0x01;
+		static constexpr uint64_t underflow = 0x02;
+		static constexpr uint64_t overflow = 0x04;
+		static constexpr uint64_t divByZero = 0x08;
+		static constexpr uint64_t invalid = 0x10;
+	}
+
 	struct Instruction {
 	public:
 		rv64::Opcode opcode = rv64::Opcode::_invalid;
@@ -108,7 +108,10 @@ bool rv64::Cpu::setupCpu(sys::Writer* writer) {
 	return true;
 }
 bool rv64::Cpu::setupCore(wasm::Module& mod) {
-	return pTranslator.setup();
+	return pTranslator.setupCore();
+}
+void rv64::Cpu::setupBlock(wasm::Module& mod) {
+	pTranslator.setupBlock();
 }
 bool rv64::Cpu::setupContext(env::guest_t pcAddress, env::guest_t spAddress) {
 	rv64::Context& ctx = env::Instance()->context().get<rv64::Context>();
@@ -120,6 +123,17 @@ bool rv64::Cpu::setupContext(env::guest_t pcAddress, env::guest_t spAddress) {
 
 	return true;
 }
+void rv64::Cpu::setupThread(env::guest_t spAddress, env::guest_t tlsAddress, bool setTls) {
+	rv64::Context& ctx = env::Instance()->context().get<rv64::Context>();
+
+	/* the child returns from the clone-syscall with a null-result (a null
+	*	stack-pointer implies the stack of the parent is to be reused) */
+	ctx.a0 = 0;
+	if (spAddress != 0)
+		ctx.sp = spAddress;
+	if (setTls)
+		ctx.tp = tlsAddress;
+}
 
 void rv64::Cpu::started(env::guest_t address) {
 	pDecoded.clear();
@@ -184,154 +198,131 @@ void rv64::Cpu::produce(env::guest_t address, const uintptr_t* self, size_t coun
 		pTranslator.next(pDecoded[self[i]]);
 }
 
-sys::SyscallArgs rv64::Cpu::syscallGetArgs() const {
-	/*
-	*	syscall calling convention:
-	*	args in [a0, ..., a5]
-	*	syscall-index in [a7]
-	*	result into a0
-	*/
-	sys::SyscallArgs call;
-	rv64::Context& ctx = env::Instance()->context().get<rv64::Context>();
-
-	/* fetch the arguments */
-	for (size_t i = 0; i < 6; ++i)
-		call.args[i] = ctx.iregs[reg::A0 + i];
-	call.rawIndex = ctx.a7;
-
-	/* check if its the vendor specific syscall 'riscv_hwprobe' */
-	if (call.rawIndex == 258) {
-		call.args[0] = fHandleHWProbe(call.args[0], call.args[1], call.args[2], call.args[3], call.args[4]);
-		call.index = sys::SyscallIndex::completed;
-		return call;
-	}
-
-	/* map the index */
-	switch (call.rawIndex) {
+sys::SyscallIndex rv64::Cpu::MapSyscall(uint64_t rawIndex) {
+	switch (rawIndex) {
 	case 17:
-		call.index = sys::SyscallIndex::getcwd;
-		break;
+		return sys::SyscallIndex::getcwd;
 	case 25:
-		call.index = sys::SyscallIndex::fcntl;
-		break;
+		return sys::SyscallIndex::fcntl;
 	case 29:
-		call.index = sys::SyscallIndex::ioctl;
-		break;
+		return sys::SyscallIndex::ioctl;
 	case 48:
-		call.index = sys::SyscallIndex::faccessat;
-		break;
+		return sys::SyscallIndex::faccessat;
 	case 49:
-		call.index = sys::SyscallIndex::chdir;
-		break;
+		return sys::SyscallIndex::chdir;
 	case 56:
-		call.index = sys::SyscallIndex::openat;
-		break;
+		return sys::SyscallIndex::openat;
 	case 57:
-		call.index = sys::SyscallIndex::close;
-		break;
+		return sys::SyscallIndex::close;
 	case 61:
-		call.index = sys::SyscallIndex::getdents64;
-		break;
+		return sys::SyscallIndex::getdents64;
 	case 62:
-		call.index = sys::SyscallIndex::lseek;
-		break;
+		return sys::SyscallIndex::lseek;
 	case 63:
-		call.index = sys::SyscallIndex::read;
-		break;
+		return sys::SyscallIndex::read;
 	case 64:
-		call.index = sys::SyscallIndex::write;
-		break;
+		return sys::SyscallIndex::write;
 	case 65:
-		call.index = sys::SyscallIndex::readv;
-		break;
+		return sys::SyscallIndex::readv;
 	case 66:
-		call.index = sys::SyscallIndex::writev;
-		break;
+		return sys::SyscallIndex::writev;
 	case 78:
-		call.index = sys::SyscallIndex::readlinkat;
-		break;
+		return sys::SyscallIndex::readlinkat;
 	case 79:
-		call.index = sys::SyscallIndex::fstatat;
-		break;
+		return sys::SyscallIndex::fstatat;
 	case 80:
-		call.index = sys::SyscallIndex::fstat;
-		break;
+		return sys::SyscallIndex::fstat;
+	case 93:
+		return sys::SyscallIndex::exit;
 	case 94:
-		call.index = sys::SyscallIndex::exit_group;
-		break;
+		return sys::SyscallIndex::exit_group;
 	case 96:
-		call.index = sys::SyscallIndex::set_tid_address;
-		break;
+		return sys::SyscallIndex::set_tid_address;
 	case 98:
-		call.index = sys::SyscallIndex::futex;
-		break;
+		return sys::SyscallIndex::futex;
 	case 99:
-		call.index = sys::SyscallIndex::set_robust_list;
-		break;
+		return sys::SyscallIndex::set_robust_list;
 	case 113:
-		call.index = sys::SyscallIndex::clock_gettime;
-		break;
+		return sys::SyscallIndex::clock_gettime;
+	case 124:
+		return sys::SyscallIndex::sched_yield;
 	case 131:
-		call.index = sys::SyscallIndex::tgkill;
-		break;
+		return sys::SyscallIndex::tgkill;
 	case 135:
-		call.index = sys::SyscallIndex::rt_sigprocmask;
-		break;
+		return sys::SyscallIndex::rt_sigprocmask;
 	case 160:
-		call.index = sys::SyscallIndex::uname;
-		break;
+		return sys::SyscallIndex::uname;
 	case 169:
-		call.index = sys::SyscallIndex::gettimeofday;
-		break;
+		return sys::SyscallIndex::gettimeofday;
 	case 172:
-		call.index = sys::SyscallIndex::getpid;
-		break;
+		return sys::SyscallIndex::getpid;
+	case 173:
+		return sys::SyscallIndex::getppid;
 	case 174:
-		call.index = sys::SyscallIndex::getuid;
-		break;
+		return sys::SyscallIndex::getuid;
 	case 175:
-		call.index = sys::SyscallIndex::geteuid;
-		break;
+		return sys::SyscallIndex::geteuid;
 	case 176:
-		call.index = sys::SyscallIndex::getgid;
-		break;
+		return sys::SyscallIndex::getgid;
 	case 177:
-		call.index = sys::SyscallIndex::getegid;
-		break;
+		return sys::SyscallIndex::getegid;
 	case 178:
-		call.index = sys::SyscallIndex::gettid;
-		break;
+		return sys::SyscallIndex::gettid;
 	case 179:
-		call.index = sys::SyscallIndex::sysinfo;
-		break;
+		return sys::SyscallIndex::sysinfo;
 	case 214:
-		call.index = sys::SyscallIndex::brk;
-		break;
+		return sys::SyscallIndex::brk;
 	case 215:
-		call.index = sys::SyscallIndex::munmap;
-		break;
+		return sys::SyscallIndex::munmap;
 	case 216:
-		call.index = sys::SyscallIndex::mremap;
-		break;
+		return sys::SyscallIndex::mremap;
+	case 220:
+		return sys::SyscallIndex::clone;
+	case 221:
+		return sys::SyscallIndex::execve;
 	case 222:
-		call.index = sys::SyscallIndex::mmap;
-		break;
+		return sys::SyscallIndex::mmap;
 	case 226:
-		call.index = sys::SyscallIndex::mprotect;
-		break;
+		return sys::SyscallIndex::mprotect;
+	case 258:
+		/* vendor specific syscall 'riscv_hwprobe' (performed while fetching the arguments) */
+		return sys::SyscallIndex::completed;
+	case 260:
+		return sys::SyscallIndex::wait4;
 	case 261:
-		call.index = sys::SyscallIndex::prlimit64;
-		break;
+		return sys::SyscallIndex::prlimit64;
 	case 278:
-		call.index = sys::SyscallIndex::getrandom;
-		break;
+		return sys::SyscallIndex::getrandom;
 	case 439:
-		call.index = sys::SyscallIndex::faccessat2;
-		break;
+		return sys::SyscallIndex::faccessat2;
+	case 0x5741'0001:
+		/* custom syscall (outside of the linux range) to checkpoint the process */
+		return sys::SyscallIndex::checkpoint;
 	default:
-		call.index = sys::SyscallIndex::unknown;
-		break;
+		return sys::SyscallIndex::unknown;
 	}
+}
+sys::SyscallArgs rv64::Cpu::syscallGetArgs() const {
+	/*
+	*	syscall calling convention:
+	*	args in [a0, ..., a5]
+	*	syscall-index in [a7]
+	*	result into a0
+	*/
+	sys::SyscallArgs call;
+	rv64::Context& ctx = env::Instance()->context().get<rv64::Context>();
+
+	/* fetch the arguments */
+	for (size_t i = 0; i < 6; ++i)
+		call.args[i] = ctx.iregs[reg::A0 + i];
+	call.rawIndex = ctx.a7;
+
+	/* check if its the vendor specific syscall 'riscv_hwprobe' (mapped to be completed) */
+	if (call.rawIndex == 258)
+		call.args[0] = fHandleHWProbe(call.args[0], call.args[1], call.args[2], call.args[3], call.args[4]);
+
+	/* map the index */
+	call.index = Cpu::MapSyscall(call.rawIndex);
 	return call;
 }
 void rv64::Cpu::syscallSetResult(uint64_t value) {
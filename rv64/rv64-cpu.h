@@ -31,10 +31,15 @@ namespace rv64 {
 	public:
 		static std::unique_ptr<sys::Cpu> New();
 
+		/* map the raw syscall-index to the known syscalls */
+		static sys::SyscallIndex MapSyscall(uint64_t rawIndex);
+
 	public:
 		bool setupCpu(sys::Writer* writer) final;
 		bool setupCore(wasm::Module& mod) final;
+		void setupBlock(wasm::Module& mod) final;
 		bool setupContext(env::guest_t pcAddress, env::guest_t spAddress) final;
+		void setupThread(env::guest_t spAddress, env::guest_t tlsAddress, bool setTls) final;
 
 	public:
 		void started(env::guest_t address) final;
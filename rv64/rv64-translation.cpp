@@ -2,9 +2,165 @@
 /* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
 #include "rv64-translation.h"
 #include "rv64-print.h"
+#include "rv64-cpu.h"
 
 static util::Logger logger{ u8"rv64::cpu" };
 
+/* layout of the raw bits of a float value (single-precision values reside in the lower bits of the raw register value) */
+struct FloatFormat {
+	bool half = false;
+	uint64_t mantissa = 0;
+	uint64_t infinity = 0;
+	uint64_t sign = 0;
+	int64_t lowest = 0;
+};
+static constexpr FloatFormat FloatLayout(bool half) {
+	if (half)
+		return FloatFormat{ true, 23, 0x7f80'0000, 0x8000'0000, -149 };
+	return FloatFormat{ false, 52, 0x7ff0'0000'0000'0000, 0x8000'0000'0000'0000, -1074 };
+}
+
+static void PushMagnitude(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& bits) {
+	sink[I::Local::Get(bits)];
+	sink[I::U64::Const(f.sign - 1)];
+	sink[I::U64::And()];
+}
+static void PushIsNaN(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& bits) {
+	PushMagnitude(sink, f, bits);
+	sink[I::U64::Const(f.infinity)];
+	sink[I::U64::Greater()];
+}
+static void PushIsInf(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& bits) {
+	PushMagnitude(sink, f, bits);
+	sink[I::U64::Const(f.infinity)];
+	sink[I::U64::Equal()];
+}
+static void PushIsSignaling(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& bits) {
+	/* signaling NaNs lie between infinity and the first quiet NaN (top mantissa-bit set) */
+	PushMagnitude(sink, f, bits);
+	sink[I::U64::Const(f.infinity + 1)];
+	sink[I::U64::Sub()];
+	sink[I::U64::Const((uint64_t(1) << (f.mantissa - 1)) - 1)];
+	sink[I::U64::Less()];
+}
+static void PushFloat(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& bits) {
+	sink[I::Local::Get(bits)];
+	if (f.half) {
+		sink[I::U64::Shrink()];
+		sink[I::U32::AsFloat()];
+	}
+	else
+		sink[I::U64::AsFloat()];
+}
+static void PushConst(wasm::Sink& sink, const FloatFormat& f, double value) {
+	if (f.half) {
+		sink[I::U32::Const(std::bit_cast<uint32_t, float>(float(value)))];
+		sink[I::U32::AsFloat()];
+	}
+	else {
+		sink[I::U64::Const(std::bit_cast<uint64_t, double>(value))];
+		sink[I::U64::AsFloat()];
+	}
+}
+static void PushBits(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& value) {
+	sink[I::Local::Get(value)];
+	if (f.half) {
+		sink[I::F32::AsInt()];
+		sink[I::U32::Expand()];
+	}
+	else
+		sink[I::F64::AsInt()];
+}
+static void PushWidth(wasm::Sink& sink, const wasm::Variable& value) {
+	sink[I::U64::Const(64)];
+	sink[I::Local::Get(value)];
+	sink[I::U64::LeadingNulls()];
+	sink[I::U64::Sub()];
+}
+static void Decompose(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& bits, const wasm::Variable& mantissa, const wasm::Variable& exponent) {
+	/* split the finite value into its odd integer mantissa and the exponent of its lowest bit (zero produces a zero mantissa) */
+	PushMagnitude(sink, f, bits);
+	sink[I::U64::Const(f.mantissa)];
+	sink[I::U64::ShiftRight()];
+	sink[I::Local::Set(exponent)];
+
+	/* add the implicit leading one to the mantissa of normal values */
+	sink[I::Local::Get(bits)];
+	sink[I::U64::Const((uint64_t(1) << f.mantissa) - 1)];
+	sink[I::U64::And()];
+	sink[I::U64::Const(uint64_t(1) << f.mantissa)];
+	sink[I::U64::Const(0)];
+	sink[I::Local::Get(exponent)];
+	sink[I::U64::Const(0)];
+	sink[I::U64::NotEqual()];
+	sink[I::Select()];
+	sink[I::U64::Or()];
+	sink[I::Local::Set(mantissa)];
+
+	/* compute the exponent of the lowest mantissa-bit (subnormals share the exponent of the smallest normals) */
+	sink[I::U64::Const(1)];
+	sink[I::Local::Get(exponent)];
+	sink[I::Local::Get(exponent)];
+	sink[I::U64::EqualZero()];
+	sink[I::Select()];
+	sink[I::I64::Const(f.lowest - 1)];
+	sink[I::U64::Add()];
+
+	/* strip the trailing zeros of the mantissa */
+	sink[I::Local::Get(mantissa)];
+	sink[I::U64::TrailingNulls()];
+	sink[I::U64::Add()];
+	sink[I::Local::Set(exponent)];
+	sink[I::Local::Get(mantissa)];
+	sink[I::Local::Get(mantissa)];
+	sink[I::U64::TrailingNulls()];
+	sink[I::U64::ShiftRight()];
+	sink[I::Local::Set(mantissa)];
+}
+static void PushResultFlags(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& bits, const wasm::Variable& inexact) {
+	/* expects finite operands (infinite results have overflowed and tininess is detected after rounding) */
+	sink[I::U32::Const(uint32_t(rv64::fflags::overflow | rv64::fflags::inexact))];
+	sink[I::U32::Const(uint32_t(rv64::fflags::underflow | rv64::fflags::inexact))];
+	sink[I::U32::Const(uint32_t(rv64::fflags::inexact))];
+	PushMagnitude(sink, f, bits);
+	sink[I::U64::Const(uint64_t(1) << f.mantissa)];
+	sink[I::U64::Less()];
+	sink[I::Select()];
+	sink[I::U32::Const(0)];
+	sink[I::Local::Get(inexact)];
+	sink[I::Select()];
+	PushIsInf(sink, f, bits);
+	sink[I::Select()];
+}
+static void ReturnNaNFlags(wasm::Sink& sink, const FloatFormat& f, const wasm::Variable& a, const wasm::Variable& b) {
+	/* check if any of the operands is a NaN, in which case only signaling NaNs raise the invalid flag */
+	PushIsNaN(sink, f, a);
+	PushIsNaN(sink, f, b);
+	sink[I::U32::Or()];
+	wasm::IfThen _if{ sink };
+	sink[I::U32::Const(uint32_t(rv64::fflags::invalid))];
+	sink[I::U32::Const(0)];
+	PushIsSignaling(sink, f, a);
+	PushIsSignaling(sink, f, b);
+	sink[I::U32::Or()];
+	sink[I::Select()];
+	sink[I::Return()];
+}
+static void ReturnConst(wasm::Sink& sink, uint64_t flags) {
+	/* return the flags, if the condition on the stack is true */
+	wasm::IfThen _if{ sink };
+	sink[I::U32::Const(uint32_t(flags))];
+	sink[I::Return()];
+}
+static std::vector<wasm::Prototype> FlagPrototypes() {
+	/* all float-flag helpers receive raw i64 values and return the raised flags */
+	std::vector<wasm::Prototype> prototypes;
+	prototypes.push_back(gen::Module->prototype(u8"rv64_flags_1_type", { { u8"a", wasm::Type::i64 } }, { wasm::Type::i32 }));
+	prototypes.push_back(gen::Module->prototype(u8"rv64_flags_2_type", { { u8"a", wasm::Type::i64 }, { u8"b", wasm::Type::i64 } }, { wasm::Type::i32 }));
+	prototypes.push_back(gen::Module->prototype(u8"rv64_flags_3_type", { { u8"a", wasm::Type::i64 }, { u8"b", wasm::Type::i64 }, { u8"c", wasm::Type::i64 } }, { wasm::Type::i32 }));
+	return prototypes;
+}
+
 std::pair<uint32_t, uint32_t> rv64::Translate::fGetCsrPlacement(uint16_t csr) const {
 	uint32_t shift = 0, mask = 0;
 
@@ -50,11 +206,11 @@ wasm::Variable rv64::Translate::fTempf64() {
 	return var;
 }
 
-uint32_t rv64::Translate::fClassifyFloat(int _class, bool _sign, bool _topMantissa) {
-	uint32_t out = 0;
-	auto set = [&](uint32_t index, bool value) { out |= ((value ? 0x01 : 0x00) << index); };
+void rv64::Translate::fDefineClassify(bool half) {
+	uint64_t mantissaBits = (half ? 23 : 52);
+	uint64_t exponentMask = (half ? 0xff : 0x7ff);
 
-	/*
+	/* the value is passed in as raw bits (expanded to 64-bit) and the class-mask is returned
 	*	bit[0]: is -inf
 	*	bit[1]: is neg normal
 	*	bit[2]: is neg subnormal
@@ -66,98 +222,1234 @@ uint32_t rv64::Translate::fClassifyFloat(int _class, bool _sign, bool _topMantis
 	*	bit[8]: is signaling NaN
 	*	bit[9]: is quite NaN
 	*/
+	wasm::Prototype prototype = gen::Module->prototype(half ? u8"rv64_classify_f32_type" : u8"rv64_classify_f64_type", { { u8"value", wasm::Type::i64 } }, { wasm::Type::i32 });
+	wasm::Sink sink{ gen::Module->function(half ? u8"rv64_classify_f32" : u8"rv64_classify_f64", prototype, wasm::Export{}) };
+	wasm::Variable exponent = sink.local(wasm::Type::i64, u8"exponent");
+	wasm::Variable mantissa = sink.local(wasm::Type::i64, u8"mantissa");
+	wasm::Variable index = sink.local(wasm::Type::i32, u8"index");
+
+	/* split the value into its exponent and mantissa */
+	sink[I::Param::Get(0)];
+	sink[I::U64::Const(mantissaBits)];
+	sink[I::U64::ShiftRight()];
+	sink[I::U64::Const(exponentMask)];
+	sink[I::U64::And()];
+	sink[I::Local::Set(exponent)];
+	sink[I::Param::Get(0)];
+	sink[I::U64::Const((uint64_t(1) << mantissaBits) - 1)];
+	sink[I::U64::And()];
+	sink[I::Local::Set(mantissa)];
+
+	/* check if the value is a NaN and select the signaling or quiet bit based on the top mantissa-bit */
+	sink[I::Local::Get(exponent)];
+	sink[I::U64::Const(exponentMask)];
+	sink[I::U64::Equal()];
+	sink[I::Local::Get(mantissa)];
+	sink[I::U64::Const(0)];
+	sink[I::U64::NotEqual()];
+	sink[I::U32::And()];
+	{
+		wasm::IfThen _if{ sink };
+		sink[I::U32::Const(0x100)];
+		sink[I::Local::Get(mantissa)];
+		sink[I::U64::Const(mantissaBits - 1)];
+		sink[I::U64::ShiftRight()];
+		sink[I::U64::Shrink()];
+		sink[I::U32::ShiftLeft()];
+		sink[I::Return()];
+	}
+
+	/* compute the bit-index for positive values (zero: 4, subnormal: 5, normal: 6, infinity: 7) */
+	sink[I::U32::Const(1)];
+	sink[I::U32::Const(4)];
+	sink[I::U32::Const(5)];
+	sink[I::Local::Get(mantissa)];
+	sink[I::U64::EqualZero()];
+	sink[I::Select()];
+	sink[I::U32::Const(6)];
+	sink[I::Local::Get(exponent)];
+	sink[I::U64::EqualZero()];
+	sink[I::Select()];
+	sink[I::U32::Const(7)];
+	sink[I::Local::Get(exponent)];
+	sink[I::U64::Const(exponentMask)];
+	sink[I::U64::NotEqual()];
+	sink[I::Select()];
+
+	/* mirror the bit-index for negative values and produce the final mask */
+	sink[I::Local::Tee(index)];
+	sink[I::U32::Const(7)];
+	sink[I::U32::XOr()];
+	sink[I::Local::Get(index)];
+	sink[I::Param::Get(0)];
+	sink[I::U64::Const(half ? 31 : 63)];
+	sink[I::U64::ShiftRight()];
+	sink[I::U64::Shrink()];
+	sink[I::Select()];
+	sink[I::U32::ShiftLeft()];
+}
+std::pair<std::u8string, size_t> rv64::Translate::fFlagHelper(FlagHelper helper, bool half) {
+	std::u8string_view name;
+	size_t params = 2;
 
-	switch (_class) {
-	case FP_INFINITE:
-		set(0, _sign);
-		set(7, !_sign);
+	switch (helper) {
+	case FlagHelper::add:
+		name = u8"add";
+		break;
+	case FlagHelper::mul:
+		name = u8"mul";
 		break;
-	case FP_NORMAL:
-		set(1, _sign);
-		set(6, !_sign);
+	case FlagHelper::fused:
+		name = u8"fused";
+		params = 3;
 		break;
-	case FP_SUBNORMAL:
-		set(2, _sign);
-		set(5, !_sign);
+	case FlagHelper::div:
+		name = u8"div";
 		break;
-	case FP_ZERO:
-		set(3, _sign);
-		set(4, !_sign);
+	case FlagHelper::sqrt:
+		name = u8"sqrt";
+		params = 1;
 		break;
-	case FP_NAN:
-		set(8, !_topMantissa);
-		set(9, _topMantissa);
+	case FlagHelper::signaling:
+		name = u8"signaling";
+		break;
+	case FlagHelper::compare:
+		name = u8"compare";
+		break;
+	case FlagHelper::toInt:
+		name = u8"to_int";
+		params = 3;
+		break;
+	case FlagHelper::fromInt:
+		name = u8"from_int";
+		break;
+	default:
 		break;
 	}
-	return out;
+
+	return { str::u8::Build(u8"rv64_flags_", name, (half ? u8"_f32" : u8"_f64")), params };
 }
-uint32_t rv64::Translate::fClassifyf32(float value) {
-	int _class = std::fpclassify(value);
-	bool _sign = std::signbit(value);
-	bool _topMantissa = bool((std::bit_cast<uint32_t, float>(value) >> 22) & 0x01);
-	return fClassifyFloat(_class, _sign, _topMantissa);
+void rv64::Translate::fDefineFlags(bool half, const std::vector<wasm::Prototype>& prototypes, wasm::Function* functions) {
+	FloatFormat f = FloatLayout(half);
+	wasm::Type type = (half ? wasm::Type::f32 : wasm::Type::f64);
+
+	/* create all functions upfront (the fused flags are computed from the product and addition flags) */
+	for (size_t i = 0; i < size_t(FlagHelper::_end); ++i) {
+		auto [name, params] = fFlagHelper(FlagHelper(i), half);
+		functions[i] = gen::Module->function(name, prototypes[params - 1], wasm::Export{});
+	}
+
+	/*
+	*	Note: all values are passed in as raw bits (expanded to 64-bit) and the raised flags are returned,
+	*	and the exactness of the results is determined without fused multiply-add, which wasm does not offer
+	*/
+
+	/* add: a + b (subtractions pass in the negated second operand) */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::add)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable b = sink.local(wasm::Type::i64, u8"b");
+		wasm::Variable bits = sink.local(wasm::Type::i64, u8"bits");
+		wasm::Variable fa = sink.local(type, u8"fa");
+		wasm::Variable fb = sink.local(type, u8"fb");
+		wasm::Variable r = sink.local(type, u8"r");
+		wasm::Variable t = sink.local(type, u8"t");
+		wasm::Variable inexact = sink.local(wasm::Type::i32, u8"inexact");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Set(a)];
+		sink[I::Param::Get(1)];
+		sink[I::Local::Set(b)];
+		ReturnNaNFlags(sink, f, a, b);
+
+		/* compute the result and check for invalid operations (inf - inf) and otherwise exact infinite operands */
+		PushFloat(sink, f, a);
+		sink[I::Local::Tee(fa)];
+		PushFloat(sink, f, b);
+		sink[I::Local::Tee(fb)];
+		sink[half ? I::F32::Add() : I::F64::Add()];
+		sink[I::Local::Tee(r)];
+		sink[I::Local::Get(r)];
+		sink[half ? I::F32::NotEqual() : I::F64::NotEqual()];
+		ReturnConst(sink, rv64::fflags::invalid);
+		PushIsInf(sink, f, a);
+		PushIsInf(sink, f, b);
+		sink[I::U32::Or()];
+		ReturnConst(sink, 0);
+
+		/* compute the rounding error of the addition (two-sum algorithm - subnormal sums are always exact) */
+		sink[I::Local::Get(r)];
+		sink[I::Local::Get(fa)];
+		sink[half ? I::F32::Sub() : I::F64::Sub()];
+		sink[I::Local::Set(t)];
+		sink[I::Local::Get(fa)];
+		sink[I::Local::Get(r)];
+		sink[I::Local::Get(t)];
+		sink[half ? I::F32::Sub() : I::F64::Sub()];
+		sink[half ? I::F32::Sub() : I::F64::Sub()];
+		sink[I::Local::Get(fb)];
+		sink[I::Local::Get(t)];
+		sink[half ? I::F32::Sub() : I::F64::Sub()];
+		sink[half ? I::F32::Add() : I::F64::Add()];
+		PushConst(sink, f, 0.0);
+		sink[half ? I::F32::NotEqual() : I::F64::NotEqual()];
+		sink[I::Local::Set(inexact)];
+		PushBits(sink, f, r);
+		sink[I::Local::Set(bits)];
+		PushResultFlags(sink, f, bits, inexact);
+	}
+
+	/* mul: a * b */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::mul)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable b = sink.local(wasm::Type::i64, u8"b");
+		wasm::Variable bits = sink.local(wasm::Type::i64, u8"bits");
+		wasm::Variable ma = sink.local(wasm::Type::i64, u8"ma");
+		wasm::Variable ea = sink.local(wasm::Type::i64, u8"ea");
+		wasm::Variable mb = sink.local(wasm::Type::i64, u8"mb");
+		wasm::Variable eb = sink.local(wasm::Type::i64, u8"eb");
+		wasm::Variable r = sink.local(type, u8"r");
+		wasm::Variable inexact = sink.local(wasm::Type::i32, u8"inexact");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Set(a)];
+		sink[I::Param::Get(1)];
+		sink[I::Local::Set(b)];
+		ReturnNaNFlags(sink, f, a, b);
+
+		/* compute the result and check for invalid operations (0 * inf) and otherwise exact infinite or zero operands */
+		PushFloat(sink, f, a);
+		PushFloat(sink, f, b);
+		sink[half ? I::F32::Mul() : I::F64::Mul()];
+		sink[I::Local::Tee(r)];
+		sink[I::Local::Get(r)];
+		sink[half ? I::F32::NotEqual() : I::F64::NotEqual()];
+		ReturnConst(sink, rv64::fflags::invalid);
+		PushIsInf(sink, f, a);
+		PushIsInf(sink, f, b);
+		sink[I::U32::Or()];
+		PushMagnitude(sink, f, a);
+		sink[I::U64::EqualZero()];
+		sink[I::U32::Or()];
+		PushMagnitude(sink, f, b);
+		sink[I::U64::EqualZero()];
+		sink[I::U32::Or()];
+		ReturnConst(sink, 0);
+
+		/* the product is exact, if the product of the odd mantissas fits into the mantissa and its lowest bit lies on the
+		*	subnormal grid (the product of the mantissas is only meaningful, if it does not exceed 64 bits) */
+		Decompose(sink, f, a, ma, ea);
+		Decompose(sink, f, b, mb, eb);
+		sink[I::Local::Get(ea)];
+		sink[I::Local::Get(eb)];
+		sink[I::U64::Add()];
+		sink[I::I64::Const(f.lowest)];
+		sink[I::I64::Less()];
+		PushWidth(sink, ma);
+		PushWidth(sink, mb);
+		sink[I::U64::Add()];
+		sink[I::U64::Const(64)];
+		sink[I::U64::Greater()];
+		sink[I::U32::Or()];
+		sink[I::Local::Get(ma)];
+		sink[I::Local::Get(mb)];
+		sink[I::U64::Mul()];
+		sink[I::U64::LeadingNulls()];
+		sink[I::U64::Const(63 - f.mantissa)];
+		sink[I::U64::Less()];
+		sink[I::U32::Or()];
+		sink[I::Local::Set(inexact)];
+		PushBits(sink, f, r);
+		sink[I::Local::Set(bits)];
+		PushResultFlags(sink, f, bits, inexact);
+	}
+
+	/* fused: a * b + c (subtractions pass in the negated third operand - the operations are not fused by the translation) */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::fused)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable b = sink.local(wasm::Type::i64, u8"b");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Tee(a)];
+		sink[I::Param::Get(1)];
+		sink[I::Local::Tee(b)];
+		sink[I::Call::Direct(functions[size_t(FlagHelper::mul)])];
+		PushFloat(sink, f, a);
+		PushFloat(sink, f, b);
+		sink[half ? I::F32::Mul() : I::F64::Mul()];
+		if (half) {
+			sink[I::F32::AsInt()];
+			sink[I::U32::Expand()];
+		}
+		else
+			sink[I::F64::AsInt()];
+		sink[I::Param::Get(2)];
+		sink[I::Call::Direct(functions[size_t(FlagHelper::add)])];
+		sink[I::U32::Or()];
+	}
+
+	/* div: a / b */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::div)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable b = sink.local(wasm::Type::i64, u8"b");
+		wasm::Variable bits = sink.local(wasm::Type::i64, u8"bits");
+		wasm::Variable ma = sink.local(wasm::Type::i64, u8"ma");
+		wasm::Variable ea = sink.local(wasm::Type::i64, u8"ea");
+		wasm::Variable mb = sink.local(wasm::Type::i64, u8"mb");
+		wasm::Variable eb = sink.local(wasm::Type::i64, u8"eb");
+		wasm::Variable mr = sink.local(wasm::Type::i64, u8"mr");
+		wasm::Variable er = sink.local(wasm::Type::i64, u8"er");
+		wasm::Variable r = sink.local(type, u8"r");
+		wasm::Variable inexact = sink.local(wasm::Type::i32, u8"inexact");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Set(a)];
+		sink[I::Param::Get(1)];
+		sink[I::Local::Set(b)];
+		ReturnNaNFlags(sink, f, a, b);
+
+		/* compute the result and check for invalid operations (0 / 0, inf / inf), exact infinite operands, and divisions by zero */
+		PushFloat(sink, f, a);
+		PushFloat(sink, f, b);
+		sink[half ? I::F32::Div() : I::F64::Div()];
+		sink[I::Local::Tee(r)];
+		sink[I::Local::Get(r)];
+		sink[half ? I::F32::NotEqual() : I::F64::NotEqual()];
+		ReturnConst(sink, rv64::fflags::invalid);
+		PushIsInf(sink, f, a);
+		PushIsInf(sink, f, b);
+		sink[I::U32::Or()];
+		ReturnConst(sink, 0);
+		PushMagnitude(sink, f, b);
+		sink[I::U64::EqualZero()];
+		ReturnConst(sink, rv64::fflags::divByZero);
+
+		/* the quotient of a non-zero dividend is exact, if multiplying it back produces the dividend (compared
+		*	on the odd mantissas and exponents - quotients, which underflowed to zero, never match) */
+		PushBits(sink, f, r);
+		sink[I::Local::Set(bits)];
+		Decompose(sink, f, a, ma, ea);
+		Decompose(sink, f, b, mb, eb);
+		Decompose(sink, f, bits, mr, er);
+		PushWidth(sink, mr);
+		PushWidth(sink, mb);
+		sink[I::U64::Add()];
+		sink[I::U64::Const(64)];
+		sink[I::U64::LessEqual()];
+		sink[I::Local::Get(mr)];
+		sink[I::Local::Get(mb)];
+		sink[I::U64::Mul()];
+		sink[I::Local::Get(ma)];
+		sink[I::U64::Equal()];
+		sink[I::U32::And()];
+		sink[I::Local::Get(er)];
+		sink[I::Local::Get(eb)];
+		sink[I::U64::Add()];
+		sink[I::Local::Get(ea)];
+		sink[I::U64::Equal()];
+		sink[I::U32::And()];
+		sink[I::U32::EqualZero()];
+		sink[I::Local::Get(ma)];
+		sink[I::U64::Const(0)];
+		sink[I::U64::NotEqual()];
+		sink[I::U32::And()];
+		sink[I::Local::Set(inexact)];
+		PushResultFlags(sink, f, bits, inexact);
+	}
+
+	/* sqrt: sqrt(a) */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::sqrt)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable bits = sink.local(wasm::Type::i64, u8"bits");
+		wasm::Variable ma = sink.local(wasm::Type::i64, u8"ma");
+		wasm::Variable ea = sink.local(wasm::Type::i64, u8"ea");
+		wasm::Variable mr = sink.local(wasm::Type::i64, u8"mr");
+		wasm::Variable er = sink.local(wasm::Type::i64, u8"er");
+		wasm::Variable r = sink.local(type, u8"r");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Set(a)];
+		ReturnNaNFlags(sink, f, a, a);
+
+		/* check for negative values (except for negative zero) and otherwise exact infinite or zero values */
+		sink[I::Local::Get(a)];
+		sink[I::U64::Const(f.sign)];
+		sink[I::U64::And()];
+		sink[I::U64::Const(0)];
+		sink[I::U64::NotEqual()];
+		PushMagnitude(sink, f, a);
+		sink[I::U64::Const(0)];
+		sink[I::U64::NotEqual()];
+		sink[I::U32::And()];
+		ReturnConst(sink, rv64::fflags::invalid);
+		PushIsInf(sink, f, a);
+		PushMagnitude(sink, f, a);
+		sink[I::U64::EqualZero()];
+		sink[I::U32::Or()];
+		ReturnConst(sink, 0);
+
+		/* the root is exact, if squaring it produces the value again (the root can neither overflow nor underflow) */
+		PushFloat(sink, f, a);
+		sink[half ? I::F32::SquareRoot() : I::F64::SquareRoot()];
+		sink[I::Local::Set(r)];
+		PushBits(sink, f, r);
+		sink[I::Local::Set(bits)];
+		Decompose(sink, f, a, ma, ea);
+		Decompose(sink, f, bits, mr, er);
+		sink[I::U32::Const(0)];
+		sink[I::U32::Const(uint32_t(rv64::fflags::inexact))];
+		PushWidth(sink, mr);
+		sink[I::U64::Const(32)];
+		sink[I::U64::LessEqual()];
+		sink[I::Local::Get(mr)];
+		sink[I::Local::Get(mr)];
+		sink[I::U64::Mul()];
+		sink[I::Local::Get(ma)];
+		sink[I::U64::Equal()];
+		sink[I::U32::And()];
+		sink[I::Local::Get(er)];
+		sink[I::Local::Get(er)];
+		sink[I::U64::Add()];
+		sink[I::Local::Get(ea)];
+		sink[I::U64::Equal()];
+		sink[I::U32::And()];
+		sink[I::Select()];
+	}
+
+	/* signaling: quiet comparisons, min/max and widening (only signaling NaNs are invalid) */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::signaling)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable b = sink.local(wasm::Type::i64, u8"b");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Set(a)];
+		sink[I::Param::Get(1)];
+		sink[I::Local::Set(b)];
+		sink[I::U32::Const(uint32_t(rv64::fflags::invalid))];
+		sink[I::U32::Const(0)];
+		PushIsSignaling(sink, f, a);
+		PushIsSignaling(sink, f, b);
+		sink[I::U32::Or()];
+		sink[I::Select()];
+	}
+
+	/* compare: signaling comparisons (any NaN is invalid) */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::compare)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable b = sink.local(wasm::Type::i64, u8"b");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Set(a)];
+		sink[I::Param::Get(1)];
+		sink[I::Local::Set(b)];
+		sink[I::U32::Const(uint32_t(rv64::fflags::invalid))];
+		sink[I::U32::Const(0)];
+		PushIsNaN(sink, f, a);
+		PushIsNaN(sink, f, b);
+		sink[I::U32::Or()];
+		sink[I::Select()];
+	}
+
+	/* to_int: truncation of a to an integer within [lower, upper) (bounds are powers of two and therefore exactly representable) */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::toInt)] };
+		wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+		wasm::Variable lower = sink.local(wasm::Type::i64, u8"lower");
+		wasm::Variable upper = sink.local(wasm::Type::i64, u8"upper");
+		wasm::Variable ma = sink.local(wasm::Type::i64, u8"ma");
+		wasm::Variable ea = sink.local(wasm::Type::i64, u8"ea");
+		sink[I::Param::Get(0)];
+		sink[I::Local::Set(a)];
+		sink[I::Param::Get(1)];
+		sink[I::Local::Set(lower)];
+		sink[I::Param::Get(2)];
+		sink[I::Local::Set(upper)];
+		PushIsNaN(sink, f, a);
+		ReturnConst(sink, rv64::fflags::invalid);
+
+		/* check if the truncated value lies outside of the range (truncation towards zero only leaves values
+		*	below the lower bound, if they are at least one below it - the difference is exact close to the bound) */
+		PushFloat(sink, f, upper);
+		PushFloat(sink, f, a);
+		sink[half ? I::F32::LessEqual() : I::F64::LessEqual()];
+		PushFloat(sink, f, a);
+		PushFloat(sink, f, lower);
+		sink[half ? I::F32::Sub() : I::F64::Sub()];
+		PushConst(sink, f, -1.0);
+		sink[half ? I::F32::LessEqual() : I::F64::LessEqual()];
+		sink[I::U32::Or()];
+		ReturnConst(sink, rv64::fflags::invalid);
+
+		/* the conversion is inexact, if the non-zero value has any fractional bits */
+		Decompose(sink, f, a, ma, ea);
+		sink[I::U32::Const(uint32_t(rv64::fflags::inexact))];
+		sink[I::U32::Const(0)];
+		sink[I::Local::Get(ea)];
+		sink[I::I64::Const(0)];
+		sink[I::I64::Less()];
+		sink[I::Local::Get(ma)];
+		sink[I::U64::Const(0)];
+		sink[I::U64::NotEqual()];
+		sink[I::U32::And()];
+		sink[I::Select()];
+	}
+
+	/* from_int: conversion of the integer a (signed, if b is non-zero) */
+	{
+		wasm::Sink sink{ functions[size_t(FlagHelper::fromInt)] };
+		wasm::Variable magnitude = sink.local(wasm::Type::i64, u8"magnitude");
+		sink[I::U32::Const(uint32_t(rv64::fflags::inexact))];
+		sink[I::U32::Const(0)];
+
+		/* compute the magnitude of the value */
+		sink[I::U64::Const(0)];
+		sink[I::Param::Get(0)];
+		sink[I::U64::Sub()];
+		sink[I::Param::Get(0)];
+		sink[I::Param::Get(1)];
+		sink[I::U64::Const(0)];
+		sink[I::U64::NotEqual()];
+		sink[I::Param::Get(0)];
+		sink[I::I64::Const(0)];
+		sink[I::I64::Less()];
+		sink[I::U32::And()];
+		sink[I::Select()];
+		sink[I::Local::Tee(magnitude)];
+
+		/* the conversion is inexact, if the significant bits do not fit into the mantissa (zero has no significant bits) */
+		sink[I::U64::LeadingNulls()];
+		sink[I::Local::Get(magnitude)];
+		sink[I::U64::TrailingNulls()];
+		sink[I::U64::Add()];
+		sink[I::U64::Const(63 - f.mantissa)];
+		sink[I::U64::Less()];
+		sink[I::Select()];
+	}
 }
-uint32_t rv64::Translate::fClassifyf64(double value) {
-	int _class = std::fpclassify(value);
-	bool _sign = std::signbit(value);
-	bool _topMantissa = bool((std::bit_cast<uint64_t, double>(value) >> 51) & 0x01);
-	return fClassifyFloat(_class, _sign, _topMantissa);
+void rv64::Translate::fDefineNarrowFlags(const std::vector<wasm::Prototype>& prototypes) {
+	FloatFormat source = FloatLayout(false), target = FloatLayout(true);
+
+	/* narrow: conversion of the double a to a float */
+	wasm::Sink sink{ gen::Module->function(u8"rv64_flags_narrow", prototypes[0], wasm::Export{}) };
+	wasm::Variable a = sink.local(wasm::Type::i64, u8"a");
+	wasm::Variable bits = sink.local(wasm::Type::i64, u8"bits");
+	wasm::Variable fa = sink.local(wasm::Type::f64, u8"fa");
+	wasm::Variable r = sink.local(wasm::Type::f32, u8"r");
+	wasm::Variable inexact = sink.local(wasm::Type::i32, u8"inexact");
+	sink[I::Param::Get(0)];
+	sink[I::Local::Set(a)];
+	ReturnNaNFlags(sink, source, a, a);
+	PushIsInf(sink, source, a);
+	ReturnConst(sink, 0);
+
+	/* the conversion is exact, if widening the result again produces the value */
+	PushFloat(sink, source, a);
+	sink[I::Local::Tee(fa)];
+	sink[I::F64::Shrink()];
+	sink[I::Local::Tee(r)];
+	sink[I::F32::Expand()];
+	sink[I::Local::Get(fa)];
+	sink[I::F64::NotEqual()];
+	sink[I::Local::Set(inexact)];
+	PushBits(sink, target, r);
+	sink[I::Local::Set(bits)];
+	PushResultFlags(sink, target, bits, inexact);
 }
 
-bool rv64::Translate::fLoadSrc1(bool forceNull, bool half) const {
-	if (pInst->src1 != reg::Zero) {
-		gen::Make->get(offsetof(rv64::Context, iregs) + pInst->src1 * sizeof(uint64_t), half ? gen::MemoryType::i32 : gen::MemoryType::i64);
+bool rv64::Translate::fCompare(rv64::Opcode opcode, uint64_t a, uint64_t b) {
+	switch (opcode) {
+	case rv64::Opcode::branch_eq:
+		return (a == b);
+	case rv64::Opcode::branch_ne:
+		return (a != b);
+	case rv64::Opcode::branch_lt_s:
+		return (int64_t(a) < int64_t(b));
+	case rv64::Opcode::branch_ge_s:
+		return (int64_t(a) >= int64_t(b));
+	case rv64::Opcode::branch_lt_u:
+		return (a < b);
+	case rv64::Opcode::branch_ge_u:
+		return (a >= b);
+	default:
+		return false;
+	}
+}
+bool rv64::Translate::fKnown(uint8_t reg, uint64_t& value) const {
+	if (reg == reg::Zero) {
+		value = 0;
+		return true;
+	}
+	if (pValues[reg].state != ValueState::constant)
+		return false;
+	value = pValues[reg].value;
+	return true;
+}
+uint8_t rv64::Translate::fResolve(uint8_t reg) const {
+	return (pValues[reg].state == ValueState::copy ? pValues[reg].reg : reg);
+}
+bool rv64::Translate::fEvaluate(uint64_t& value) const {
+	uint64_t a = 0, b = 0;
+	bool aKnown = fKnown(pInst->src1, a), bKnown = fKnown(pInst->src2, b);
+	uint64_t imm = uint64_t(pInst->imm);
+
+	/* handle all immediate-loads, which are always known */
+	switch (pInst->opcode) {
+	case rv64::Opcode::multi_load_imm:
+	case rv64::Opcode::load_upper_imm:
+		value = imm;
+		return true;
+	case rv64::Opcode::add_upper_imm_pc:
+	case rv64::Opcode::multi_load_address:
+		value = pAddress + imm;
+		return true;
+	default:
+		break;
+	}
+
+	/* check if the result is independent of the actual operand values (i.e. both operands
+	*	hold the same value or one operand of a multiplication or and-operation is null) */
+	bool same = (fResolve(pInst->src1) == fResolve(pInst->src2));
+	switch (pInst->opcode) {
+	case rv64::Opcode::sub_reg:
+	case rv64::Opcode::sub_reg_half:
+	case rv64::Opcode::xor_reg:
+	case rv64::Opcode::set_less_than_s_reg:
+	case rv64::Opcode::set_less_than_u_reg:
+		if (!same)
+			break;
+		value = 0;
+		return true;
+	case rv64::Opcode::and_reg:
+	case rv64::Opcode::mul_reg:
+	case rv64::Opcode::mul_reg_half:
+		if ((!aKnown || a != 0) && (!bKnown || b != 0))
+			break;
+		value = 0;
+		return true;
+	default:
+		break;
+	}
+
+	/* evaluate the immediate-operations (only depend on the first operand) */
+	if (!aKnown)
+		return false;
+	switch (pInst->opcode) {
+	case rv64::Opcode::add_imm:
+		value = a + imm;
+		return true;
+	case rv64::Opcode::add_imm_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) + uint32_t(imm))));
+		return true;
+	case rv64::Opcode::xor_imm:
+		value = a ^ imm;
+		return true;
+	case rv64::Opcode::or_imm:
+		value = a | imm;
 		return true;
+	case rv64::Opcode::and_imm:
+		value = a & imm;
+		return true;
+	case rv64::Opcode::shift_left_logic_imm:
+		value = a << (imm & 0x3f);
+		return true;
+	case rv64::Opcode::shift_left_logic_imm_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) << (imm & 0x1f))));
+		return true;
+	case rv64::Opcode::shift_right_logic_imm:
+		value = a >> (imm & 0x3f);
+		return true;
+	case rv64::Opcode::shift_right_logic_imm_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) >> (imm & 0x1f))));
+		return true;
+	case rv64::Opcode::shift_right_arith_imm:
+		value = uint64_t(int64_t(a) >> (imm & 0x3f));
+		return true;
+	case rv64::Opcode::shift_right_arith_imm_half:
+		value = uint64_t(int64_t(int32_t(a) >> (imm & 0x1f)));
+		return true;
+	case rv64::Opcode::set_less_than_s_imm:
+		value = (int64_t(a) < int64_t(imm) ? 1 : 0);
+		return true;
+	case rv64::Opcode::set_less_than_u_imm:
+		value = (a < imm ? 1 : 0);
+		return true;
+	default:
+		break;
+	}
+
+	/* evaluate the register-operations (depend on both operands) */
+	if (!bKnown)
+		return false;
+	switch (pInst->opcode) {
+	case rv64::Opcode::add_reg:
+		value = a + b;
+		return true;
+	case rv64::Opcode::add_reg_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) + uint32_t(b))));
+		return true;
+	case rv64::Opcode::sub_reg:
+		value = a - b;
+		return true;
+	case rv64::Opcode::sub_reg_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) - uint32_t(b))));
+		return true;
+	case rv64::Opcode::xor_reg:
+		value = a ^ b;
+		return true;
+	case rv64::Opcode::or_reg:
+		value = a | b;
+		return true;
+	case rv64::Opcode::and_reg:
+		value = a & b;
+		return true;
+	case rv64::Opcode::mul_reg:
+		value = a * b;
+		return true;
+	case rv64::Opcode::mul_reg_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) * uint32_t(b))));
+		return true;
+	case rv64::Opcode::shift_left_logic_reg:
+		value = a << (b & 0x3f);
+		return true;
+	case rv64::Opcode::shift_left_logic_reg_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) << (b & 0x1f))));
+		return true;
+	case rv64::Opcode::shift_right_logic_reg:
+		value = a >> (b & 0x3f);
+		return true;
+	case rv64::Opcode::shift_right_logic_reg_half:
+		value = uint64_t(int64_t(int32_t(uint32_t(a) >> (b & 0x1f))));
+		return true;
+	case rv64::Opcode::shift_right_arith_reg:
+		value = uint64_t(int64_t(a) >> (b & 0x3f));
+		return true;
+	case rv64::Opcode::shift_right_arith_reg_half:
+		value = uint64_t(int64_t(int32_t(a) >> (b & 0x1f)));
+		return true;
+	case rv64::Opcode::set_less_than_s_reg:
+		value = (int64_t(a) < int64_t(b) ? 1 : 0);
+		return true;
+	case rv64::Opcode::set_less_than_u_reg:
+		value = (a < b ? 1 : 0);
+		return true;
+	default:
+		return false;
+	}
+}
+void rv64::Translate::fSetUnknown(uint8_t reg) {
+	if (reg == reg::Zero)
+		return;
+
+	/* invalidate all copies of the register, as its value is about to change */
+	for (RegValue& value : pValues) {
+		if (value.state == ValueState::copy && value.reg == reg)
+			value.state = ValueState::unknown;
+	}
+	pValues[reg].state = ValueState::unknown;
+}
+void rv64::Translate::fSetConstant(uint8_t reg, uint64_t value) {
+	if (reg == reg::Zero)
+		return;
+	fSetUnknown(reg);
+	pValues[reg].state = ValueState::constant;
+	pValues[reg].value = value;
+}
+void rv64::Translate::fSetCopy(uint8_t reg, uint8_t src) {
+	/* check if the source is known, in which case the value can be tracked directly */
+	uint64_t value = 0;
+	if (fKnown(src, value)) {
+		fSetConstant(reg, value);
+		return;
+	}
+
+	/* resolve the original register and check if the value remains unchanged */
+	src = fResolve(src);
+	if (reg == reg::Zero || src == reg)
+		return;
+	fSetUnknown(reg);
+	pValues[reg].state = ValueState::copy;
+	pValues[reg].reg = src;
+}
+void rv64::Translate::fResetValues() {
+	for (RegValue& value : pValues)
+		value.state = ValueState::unknown;
+	for (bool& cached : pFloatCached)
+		cached = false;
+}
+void rv64::Translate::fUpdateValues() {
+	uint64_t value = 0;
+
+	switch (pInst->opcode) {
+	case rv64::Opcode::load_upper_imm:
+	case rv64::Opcode::add_upper_imm_pc:
+	case rv64::Opcode::multi_load_imm:
+	case rv64::Opcode::multi_load_address:
+	case rv64::Opcode::add_imm:
+	case rv64::Opcode::xor_imm:
+	case rv64::Opcode::or_imm:
+	case rv64::Opcode::and_imm:
+	case rv64::Opcode::shift_left_logic_imm:
+	case rv64::Opcode::shift_right_logic_imm:
+	case rv64::Opcode::shift_right_arith_imm:
+	case rv64::Opcode::set_less_than_s_imm:
+	case rv64::Opcode::set_less_than_u_imm:
+	case rv64::Opcode::add_imm_half:
+	case rv64::Opcode::shift_left_logic_imm_half:
+	case rv64::Opcode::shift_right_logic_imm_half:
+	case rv64::Opcode::shift_right_arith_imm_half:
+	case rv64::Opcode::add_reg:
+	case rv64::Opcode::sub_reg:
+	case rv64::Opcode::xor_reg:
+	case rv64::Opcode::or_reg:
+	case rv64::Opcode::and_reg:
+	case rv64::Opcode::mul_reg:
+	case rv64::Opcode::mul_reg_half:
+	case rv64::Opcode::set_less_than_s_reg:
+	case rv64::Opcode::set_less_than_u_reg:
+	case rv64::Opcode::shift_left_logic_reg:
+	case rv64::Opcode::shift_right_logic_reg:
+	case rv64::Opcode::shift_right_arith_reg:
+	case rv64::Opcode::add_reg_half:
+	case rv64::Opcode::sub_reg_half:
+	case rv64::Opcode::shift_left_logic_reg_half:
+	case rv64::Opcode::shift_right_logic_reg_half:
+	case rv64::Opcode::shift_right_arith_reg_half:
+		/* check if the result is known, or if its a move of another register */
+		if (fEvaluate(value))
+			fSetConstant(pInst->dest, value);
+		else if (pInst->opcode == rv64::Opcode::add_imm && pInst->imm == 0)
+			fSetCopy(pInst->dest, pInst->src1);
+		else if ((pInst->opcode == rv64::Opcode::add_reg || pInst->opcode == rv64::Opcode::or_reg || pInst->opcode == rv64::Opcode::xor_reg) && (pInst->src1 == reg::Zero || pInst->src2 == reg::Zero))
+			fSetCopy(pInst->dest, pInst->src1 == reg::Zero ? pInst->src2 : pInst->src1);
+		else
+			fSetUnknown(pInst->dest);
+		break;
+	case rv64::Opcode::jump_and_link_imm:
+	case rv64::Opcode::jump_and_link_reg:
+	case rv64::Opcode::multi_call:
+		/* calls may modify any register before returning to the next instruction */
+		if (pInst->isCall())
+			fResetValues();
+		else
+			fSetConstant(pInst->dest, pNextAddress);
+		break;
+	case rv64::Opcode::ecall:
+		/* syscalls may modify any register before resuming the execution */
+		fResetValues();
+		break;
+	case rv64::Opcode::multi_store_byte:
+	case rv64::Opcode::multi_store_half:
+	case rv64::Opcode::multi_store_word:
+	case rv64::Opcode::multi_store_dword:
+	case rv64::Opcode::multi_load_float:
+	case rv64::Opcode::multi_load_double:
+	case rv64::Opcode::multi_store_float:
+	case rv64::Opcode::multi_store_double:
+		/* the intermediate register holds the computed upper address */
+		fSetConstant(pInst->src1, pAddress + pInst->tempValue);
+		break;
+	case rv64::Opcode::load_byte_s:
+	case rv64::Opcode::load_half_s:
+	case rv64::Opcode::load_word_s:
+	case rv64::Opcode::load_byte_u:
+	case rv64::Opcode::load_half_u:
+	case rv64::Opcode::load_word_u:
+	case rv64::Opcode::load_dword:
+	case rv64::Opcode::multi_load_byte_s:
+	case rv64::Opcode::multi_load_half_s:
+	case rv64::Opcode::multi_load_word_s:
+	case rv64::Opcode::multi_load_byte_u:
+	case rv64::Opcode::multi_load_half_u:
+	case rv64::Opcode::multi_load_word_u:
+	case rv64::Opcode::multi_load_dword:
+	case rv64::Opcode::mul_high_s_reg:
+	case rv64::Opcode::mul_high_s_u_reg:
+	case rv64::Opcode::mul_high_u_reg:
+	case rv64::Opcode::div_s_reg:
+	case rv64::Opcode::div_s_reg_half:
+	case rv64::Opcode::div_u_reg:
+	case rv64::Opcode::div_u_reg_half:
+	case rv64::Opcode::rem_s_reg:
+	case rv64::Opcode::rem_s_reg_half:
+	case rv64::Opcode::rem_u_reg:
+	case rv64::Opcode::rem_u_reg_half:
+	case rv64::Opcode::load_reserved_w:
+	case rv64::Opcode::load_reserved_d:
+	case rv64::Opcode::store_conditional_w:
+	case rv64::Opcode::store_conditional_d:
+	case rv64::Opcode::amo_swap_w:
+	case rv64::Opcode::amo_add_w:
+	case rv64::Opcode::amo_xor_w:
+	case rv64::Opcode::amo_and_w:
+	case rv64::Opcode::amo_or_w:
+	case rv64::Opcode::amo_min_s_w:
+	case rv64::Opcode::amo_max_s_w:
+	case rv64::Opcode::amo_min_u_w:
+	case rv64::Opcode::amo_max_u_w:
+	case rv64::Opcode::amo_swap_d:
+	case rv64::Opcode::amo_add_d:
+	case rv64::Opcode::amo_xor_d:
+	case rv64::Opcode::amo_and_d:
+	case rv64::Opcode::amo_or_d:
+	case rv64::Opcode::amo_min_s_d:
+	case rv64::Opcode::amo_max_s_d:
+	case rv64::Opcode::amo_min_u_d:
+	case rv64::Opcode::amo_max_u_d:
+	case rv64::Opcode::csr_read_write:
+	case rv64::Opcode::csr_read_and_set:
+	case rv64::Opcode::csr_read_and_clear:
+	case rv64::Opcode::csr_read_write_imm:
+	case rv64::Opcode::csr_read_and_set_imm:
+	case rv64::Opcode::csr_read_and_clear_imm:
+	case rv64::Opcode::float_convert_to_word_s:
+	case rv64::Opcode::float_convert_to_word_u:
+	case rv64::Opcode::float_move_to_word:
+	case rv64::Opcode::float_convert_to_dword_s:
+	case rv64::Opcode::float_convert_to_dword_u:
+	case rv64::Opcode::double_convert_to_word_s:
+	case rv64::Opcode::double_convert_to_word_u:
+	case rv64::Opcode::double_convert_to_dword_s:
+	case rv64::Opcode::double_convert_to_dword_u:
+	case rv64::Opcode::double_move_to_dword:
+	case rv64::Opcode::float_equal:
+	case rv64::Opcode::float_less_equal:
+	case rv64::Opcode::float_less_than:
+	case rv64::Opcode::double_equal:
+	case rv64::Opcode::double_less_equal:
+	case rv64::Opcode::double_less_than:
+	case rv64::Opcode::float_classify:
+	case rv64::Opcode::double_classify:
+		fSetUnknown(pInst->dest);
+		break;
+	default:
+		break;
 	}
-	else if (forceNull)
-		gen::Add[half ? I::U32::Const(0) : I::U64::Const(0)];
-	return false;
+}
+
+bool rv64::Translate::fLoadSrc1(bool forceNull, bool half) const {
+	uint64_t value = 0;
+	if (pInst->src1 == reg::Zero) {
+		if (forceNull)
+			gen::Add[half ? I::U32::Const(0) : I::U64::Const(0)];
+		return false;
+	}
+
+	/* check if the value is known and can be written as constant */
+	if (fKnown(pInst->src1, value))
+		gen::Add[half ? I::U32::Const(uint32_t(value)) : I::U64::Const(value)];
+	else
+		gen::Make->get(offsetof(rv64::Context, iregs) + pInst->src1 * sizeof(uint64_t), half ? gen::MemoryType::i32 : gen::MemoryType::i64);
+	return true;
 }
 bool rv64::Translate::fLoadSrc2(bool forceNull, bool half) const {
-	if (pInst->src2 != reg::Zero) {
+	uint64_t value = 0;
+	if (pInst->src2 == reg::Zero) {
+		if (forceNull)
+			gen::Add[half ? I::U32::Const(0) : I::U64::Const(0)];
+		return false;
+	}
+
+	/* check if the value is known and can be written as constant */
+	if (fKnown(pInst->src2, value))
+		gen::Add[half ? I::U32::Const(uint32_t(value)) : I::U64::Const(value)];
+	else
 		gen::Make->get(offsetof(rv64::Context, iregs) + pInst->src2 * sizeof(uint64_t), half ? gen::MemoryType::i32 : gen::MemoryType::i64);
-		return true;
+	return true;
+}
+gen::FulFill rv64::Translate::fStoreReg(uint8_t reg) const {
+	if (reg != reg::Zero)
+		return gen::Make->set(offsetof(rv64::Context, iregs) + reg * sizeof(uint64_t), gen::MemoryType::i64);
+	return gen::FulFill{};
+}
+gen::FulFill rv64::Translate::fStoreDest() const {
+	return fStoreReg(pInst->dest);
+}
+void rv64::Translate::fLoadAddress(bool multi) const {
+	uint64_t value = 0;
+
+	/* check if the address is relative to the instruction or to a known base */
+	if (multi)
+		gen::Add[I::I64::Const(pAddress + pInst->imm)];
+	else if (fKnown(pInst->src1, value))
+		gen::Add[I::U64::Const(value + pInst->imm)];
+
+	/* compute the address based on the register */
+	else if (pInst->imm != 0) {
+		gen::Add[I::I64::Const(pInst->imm)];
+		fLoadSrc1(false, false);
+		gen::Add[I::U64::Add()];
 	}
-	else if (forceNull)
-		gen::Add[half ? I::U32::Const(0) : I::U64::Const(0)];
-	return false;
-}
-gen::FulFill rv64::Translate::fStoreReg(uint8_t reg) const {
-	if (reg != reg::Zero)
-		return gen::Make->set(offsetof(rv64::Context, iregs) + reg * sizeof(uint64_t), gen::MemoryType::i64);
-	return gen::FulFill{};
+	else
+		fLoadSrc1(false, false);
 }
-gen::FulFill rv64::Translate::fStoreDest() const {
-	return fStoreReg(pInst->dest);
+bool rv64::Translate::fMakeKnownResult() const {
+	/* check if the result of the operation can be computed already */
+	uint64_t value = 0;
+	if (!fEvaluate(value))
+		return false;
+
+	/* write the constant result to the destination */
+	gen::FulFill fulfill = fStoreDest();
+	gen::Add[I::U64::Const(value)];
+	fulfill.now();
+	return true;
 }
 
+void rv64::Translate::fLoadFReg(uint8_t reg, bool half) const {
+	/* check if the raw single-precision value is still available in its local */
+	if (half && pFloatCached[reg])
+		gen::Add[I::Local::Get(pFloatLocals[reg])];
+	else
+		gen::Make->get(offsetof(rv64::Context, fregs) + reg * sizeof(double), half ? gen::MemoryType::f32 : gen::MemoryType::f64);
+}
 void rv64::Translate::fLoadFSrc1(bool half) const {
-	gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src1 * sizeof(double), half ? gen::MemoryType::f32 : gen::MemoryType::f64);
+	fLoadFReg(pInst->src1, half);
 }
 void rv64::Translate::fLoadFSrc2(bool half) const {
-	gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src2 * sizeof(double), half ? gen::MemoryType::f32 : gen::MemoryType::f64);
+	fLoadFReg(pInst->src2, half);
 }
 void rv64::Translate::fLoadFSrc3(bool half) const {
-	gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src3 * sizeof(double), half ? gen::MemoryType::f32 : gen::MemoryType::f64);
+	fLoadFReg(pInst->src3, half);
 }
-gen::FulFill rv64::Translate::fStoreFDest(bool isAsInt) const {
-	if (isAsInt)
-		return gen::Make->set(offsetof(rv64::Context, fregs) + pInst->dest * sizeof(double), gen::MemoryType::i64);
-	return gen::Make->set(offsetof(rv64::Context, fregs) + pInst->dest * sizeof(double), gen::MemoryType::f64);
+gen::FulFill rv64::Translate::fStoreFDest(bool half) {
+	size_t offset = offsetof(rv64::Context, fregs) + pInst->dest * sizeof(double);
+
+	/* doubles invalidate any cached single-precision value of the register */
+	if (!half) {
+		pFloatCached[pInst->dest] = false;
+		return gen::Make->set(offset, gen::MemoryType::f64);
+	}
+
+	/* check if the register is already known to be NaN-boxed, in which case only the lower half needs to be written */
+	if (pFloatCached[pInst->dest])
+		return gen::Make->set(offset, gen::MemoryType::f32);
+	return gen::Make->set(offset, gen::MemoryType::i64);
 }
-void rv64::Translate::fExpandFloat(bool isAsInt, bool leaveAsInt) const {
-	/* check if the value needs to be intereprted as an integer */
-	if (!isAsInt)
-		gen::Add[I::F32::AsInt()];
+void rv64::Translate::fExpandFloat() {
+	wasm::Variable& local = pFloatLocals[pInst->dest];
+	if (!local.valid())
+		local = gen::Sink->local(wasm::Type::f32, str::u8::Build(u8"_freg_f32_", pInst->dest));
+
+	/* cache the raw value for subsequent single-precision reads of the same chunk */
+	gen::Add[I::Local::Tee(local)];
 
-	/* perform the expansion to 64-bit doubles (upper 32bits are set to 1 - NaN Boxing) */
+	/* check if the upper half of the register already holds the NaN-boxing, as set up by fStoreFDest */
+	if (pFloatCached[pInst->dest])
+		return;
+	pFloatCached[pInst->dest] = true;
+
+	/* perform the expansion to 64-bit (upper 32bits are set to 1 - NaN Boxing) */
+	gen::Add[I::F32::AsInt()];
 	gen::Add[I::U32::Expand()];
 	gen::Add[I::U64::Const(0xffff'ffff'0000'0000)];
 	gen::Add[I::U64::Or()];
+}
+void rv64::Translate::fAccumulateFlags() const {
+	FlagHelper helper = FlagHelper::_end;
+	bool half = false, negate = false, sign = false;
+	uint32_t bits = 0;
 
-	/* check if the value should be converted back to a float */
-	if (!leaveAsInt)
-		gen::Add[I::U64::AsFloat()];
+	/* select the helper to compute the flags of the operation (narrowing doubles uses the separate narrow-helper) */
+	switch (pInst->opcode) {
+	case rv64::Opcode::float_sub:
+		negate = true;
+		[[fallthrough]];
+	case rv64::Opcode::float_add:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_add:
+		helper = FlagHelper::add;
+		break;
+	case rv64::Opcode::double_sub:
+		helper = FlagHelper::add;
+		negate = true;
+		break;
+	case rv64::Opcode::float_mul:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_mul:
+		helper = FlagHelper::mul;
+		break;
+	case rv64::Opcode::float_mul_sub:
+	case rv64::Opcode::float_neg_mul_sub:
+		negate = true;
+		[[fallthrough]];
+	case rv64::Opcode::float_mul_add:
+	case rv64::Opcode::float_neg_mul_add:
+		half = true;
+		helper = FlagHelper::fused;
+		break;
+	case rv64::Opcode::double_mul_sub:
+	case rv64::Opcode::double_neg_mul_sub:
+		negate = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_mul_add:
+	case rv64::Opcode::double_neg_mul_add:
+		helper = FlagHelper::fused;
+		break;
+	case rv64::Opcode::float_div:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_div:
+		helper = FlagHelper::div;
+		break;
+	case rv64::Opcode::float_sqrt:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_sqrt:
+		helper = FlagHelper::sqrt;
+		break;
+	case rv64::Opcode::float_min:
+	case rv64::Opcode::float_max:
+	case rv64::Opcode::float_equal:
+	case rv64::Opcode::float_to_double:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_min:
+	case rv64::Opcode::double_max:
+	case rv64::Opcode::double_equal:
+		helper = FlagHelper::signaling;
+		break;
+	case rv64::Opcode::float_less_equal:
+	case rv64::Opcode::float_less_than:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_less_equal:
+	case rv64::Opcode::double_less_than:
+		helper = FlagHelper::compare;
+		break;
+	case rv64::Opcode::float_convert_to_word_s:
+	case rv64::Opcode::float_convert_to_word_u:
+	case rv64::Opcode::float_convert_to_dword_s:
+	case rv64::Opcode::float_convert_to_dword_u:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_convert_to_word_s:
+	case rv64::Opcode::double_convert_to_word_u:
+	case rv64::Opcode::double_convert_to_dword_s:
+	case rv64::Opcode::double_convert_to_dword_u:
+		helper = FlagHelper::toInt;
+		break;
+	case rv64::Opcode::float_convert_from_word_s:
+	case rv64::Opcode::float_convert_from_word_u:
+	case rv64::Opcode::float_convert_from_dword_s:
+	case rv64::Opcode::float_convert_from_dword_u:
+		half = true;
+		[[fallthrough]];
+	case rv64::Opcode::double_convert_from_word_s:
+	case rv64::Opcode::double_convert_from_word_u:
+	case rv64::Opcode::double_convert_from_dword_s:
+	case rv64::Opcode::double_convert_from_dword_u:
+		helper = FlagHelper::fromInt;
+		break;
+	case rv64::Opcode::double_to_float:
+		break;
+	default:
+		return;
+	}
+
+	/* fetch the signedness and width of the integer-operand of conversions */
+	switch (pInst->opcode) {
+	case rv64::Opcode::float_convert_to_word_s:
+	case rv64::Opcode::double_convert_to_word_s:
+	case rv64::Opcode::float_convert_from_word_s:
+	case rv64::Opcode::double_convert_from_word_s:
+		sign = true;
+		[[fallthrough]];
+	case rv64::Opcode::float_convert_to_word_u:
+	case rv64::Opcode::double_convert_to_word_u:
+	case rv64::Opcode::float_convert_from_word_u:
+	case rv64::Opcode::double_convert_from_word_u:
+		bits = 32;
+		break;
+	case rv64::Opcode::float_convert_to_dword_s:
+	case rv64::Opcode::double_convert_to_dword_s:
+	case rv64::Opcode::float_convert_from_dword_s:
+	case rv64::Opcode::double_convert_from_dword_s:
+		sign = true;
+		[[fallthrough]];
+	case rv64::Opcode::float_convert_to_dword_u:
+	case rv64::Opcode::double_convert_to_dword_u:
+	case rv64::Opcode::float_convert_from_dword_u:
+	case rv64::Opcode::double_convert_from_dword_u:
+		bits = 64;
+		break;
+	default:
+		break;
+	}
+	uint64_t signBit = (half ? 0x8000'0000 : 0x8000'0000'0000'0000);
+
+	/* prepare the accumulation of the flags (the flags are sticky) */
+	gen::FulFill fulfill = gen::Make->set(offsetof(rv64::Context, float_csr), gen::MemoryType::i64);
+	gen::Make->get(offsetof(rv64::Context, float_csr), gen::MemoryType::i64);
+
+	/* write the raw operands to the stack and compute the flags through the core helper (never leaves wasm) */
+	switch (helper) {
+	case FlagHelper::add:
+	case FlagHelper::mul:
+	case FlagHelper::div:
+	case FlagHelper::compare:
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src1 * sizeof(double), gen::MemoryType::i64);
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src2 * sizeof(double), gen::MemoryType::i64);
+		if (negate) {
+			gen::Add[I::U64::Const(signBit)];
+			gen::Add[I::U64::XOr()];
+		}
+		break;
+	case FlagHelper::signaling:
+		/* widening only checks its single operand */
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src1 * sizeof(double), gen::MemoryType::i64);
+		gen::Make->get(offsetof(rv64::Context, fregs) + (pInst->opcode == rv64::Opcode::float_to_double ? pInst->src1 : pInst->src2) * sizeof(double), gen::MemoryType::i64);
+		break;
+	case FlagHelper::fused:
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src1 * sizeof(double), gen::MemoryType::i64);
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src2 * sizeof(double), gen::MemoryType::i64);
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src3 * sizeof(double), gen::MemoryType::i64);
+		if (negate) {
+			gen::Add[I::U64::Const(signBit)];
+			gen::Add[I::U64::XOr()];
+		}
+		break;
+	case FlagHelper::sqrt:
+	case FlagHelper::_end:
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src1 * sizeof(double), gen::MemoryType::i64);
+		break;
+	case FlagHelper::toInt: {
+		/* bounds are passed in as raw values of the source precision */
+		double upper = std::ldexp(1.0, sign ? bits - 1 : bits), lower = (sign ? -std::ldexp(1.0, bits - 1) : 0.0);
+		gen::Make->get(offsetof(rv64::Context, fregs) + pInst->src1 * sizeof(double), gen::MemoryType::i64);
+		gen::Add[I::U64::Const(half ? uint64_t(std::bit_cast<uint32_t, float>(float(lower))) : std::bit_cast<uint64_t, double>(lower))];
+		gen::Add[I::U64::Const(half ? uint64_t(std::bit_cast<uint32_t, float>(float(upper))) : std::bit_cast<uint64_t, double>(upper))];
+		break;
+	}
+	case FlagHelper::fromInt:
+		fLoadSrc1(true, false);
+		if (bits == 32) {
+			gen::Add[I::U64::Shrink()];
+			gen::Add[sign ? I::I32::Expand() : I::U32::Expand()];
+		}
+		gen::Add[I::U64::Const(sign ? 1 : 0)];
+		break;
+	}
+	if (helper == FlagHelper::_end)
+		gen::Add[I::Call::Direct(pHelper.narrowFlags)];
+	else
+		gen::Add[I::Call::Direct((half ? pHelper.flags32 : pHelper.flags64)[size_t(helper)])];
+
+	/* merge the flags into the status-register */
+	gen::Add[I::U32::Expand()];
+	gen::Add[I::U64::Or()];
+	fulfill.now();
+}
+void rv64::Translate::fMakeFrmWarning(int64_t value, const wasm::Variable& var) const {
+	/* only the first unsupported rounding-mode is passed to the host (the core keeps track of it) */
+	gen::Add[I::Call::Direct(pHelper.frmFirst)];
+	wasm::IfThen _if{ gen::Sink };
+	if (var.valid())
+		gen::Add[I::Local::Get(var)];
+	else
+		gen::Add[I::I64::Const(value)];
+	gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
+	gen::Add[I::Drop()];
 }
 
 void rv64::Translate::fMakeImms() const {
@@ -212,6 +1504,34 @@ void rv64::Translate::fMakeJALI() {
 		gen::Make->jump(address);
 }
 void rv64::Translate::fMakeJALR() {
+	/* check if the target address is already known, in which case a direct jump can be added */
+	uint64_t target = 0;
+	if (fKnown(pInst->src1, target)) {
+		target += pInst->imm;
+
+		/* write the next pc to the destination register */
+		if (pInst->dest != reg::Zero) {
+			gen::FulFill fulfill = fStoreDest();
+			gen::Add[I::U64::Const(pNextAddress)];
+			fulfill.now();
+		}
+
+		/* check if the target is misaligned and add the misalignment-exception */
+		if ((target & 0x01) != 0)
+			pWriter->makeException(Translate::MisalignedException, pAddress, pNextAddress);
+
+		/* add the instruction as return, or as direct call or jump */
+		else if (pInst->isRet()) {
+			gen::Add[I::U64::Const(target)];
+			gen::Make->ret();
+		}
+		else if (pInst->isCall())
+			gen::Make->call(target, pNextAddress);
+		else
+			gen::Make->jump(target);
+		return;
+	}
+
 	/* write the target address to the stack */
 	if (fLoadSrc1(false, false)) {
 		if (pInst->imm != 0) {
@@ -262,12 +1582,18 @@ void rv64::Translate::fMakeBranch() const {
 		return;
 	}
 
-	/* check if the condition can be discarded */
-	if (pInst->src1 == pInst->src2) {
+	/* check if the condition can be discarded (either as both operands hold the same value or are known) */
+	uint64_t a = 0, b = 0;
+	if (fResolve(pInst->src1) == fResolve(pInst->src2)) {
 		if (pInst->opcode == rv64::Opcode::branch_eq || pInst->opcode == rv64::Opcode::branch_ge_s || pInst->opcode == rv64::Opcode::branch_ge_u)
 			gen::Make->jump(address);
 		return;
 	}
+	if (fKnown(pInst->src1, a) && fKnown(pInst->src2, b)) {
+		if (fCompare(pInst->opcode, a, b))
+			gen::Make->jump(address);
+		return;
+	}
 
 	/* write the result of the condition to the stack */
 	if (pInst->opcode == rv64::Opcode::branch_eq) {
@@ -312,8 +1638,8 @@ void rv64::Translate::fMakeBranch() const {
 	gen::Make->jump(address);
 }
 void rv64::Translate::fMakeALUImm() const {
-	/* check if the operation can be discarded */
-	if (pInst->dest == reg::Zero)
+	/* check if the operation can be discarded or if the result is already known */
+	if (pInst->dest == reg::Zero || fMakeKnownResult())
 		return;
 
 	/* prepare the result writeback */
@@ -427,8 +1753,8 @@ void rv64::Translate::fMakeALUImm() const {
 	fulfill.now();
 }
 void rv64::Translate::fMakeALUReg() const {
-	/* check if the operation can be discarded */
-	if (pInst->dest == reg::Zero)
+	/* check if the operation can be discarded or if the result is already known */
+	if (pInst->dest == reg::Zero || fMakeKnownResult())
 		return;
 
 	/* prepare the result writeback */
@@ -564,15 +1890,7 @@ void rv64::Translate::fMakeLoad(bool multi) const {
 	gen::FulFill fulfill = fStoreDest();
 
 	/* compute the destination address and write it to the stack */
-	if (multi)
-		gen::Add[I::I64::Const(pAddress + pInst->imm)];
-	else if (pInst->imm != 0) {
-		gen::Add[I::I64::Const(pInst->imm)];
-		if (fLoadSrc1(false, false))
-			gen::Add[I::U64::Add()];
-	}
-	else
-		fLoadSrc1(true, false);
+	fLoadAddress(multi);
 
 	/* perform the actual load of the value (memory-register maps 1-to-1 to memory-cache no matter if read or write) */
 	switch (pInst->opcode) {
@@ -613,13 +1931,7 @@ void rv64::Translate::fMakeLoad(bool multi) const {
 }
 void rv64::Translate::fMakeStore(bool multi) const {
 	/* compute the destination address and write it to the stack */
-	if (multi)
-		gen::Add[I::I64::Const(pAddress + pInst->imm)];
-	else {
-		gen::Add[I::I64::Const(pInst->imm)];
-		if (fLoadSrc1(false, false))
-			gen::Add[I::U64::Add()];
-	}
+	fLoadAddress(multi);
 
 	/* write the source value to the stack */
 	fLoadSrc2(true, (pInst->opcode != rv64::Opcode::store_dword && pInst->opcode != rv64::Opcode::multi_store_dword));
@@ -780,7 +2092,7 @@ void rv64::Translate::fMakeDivRem() {
 }
 void rv64::Translate::fMakeAMO(bool half) {
 	/*
-	*	Note: simply treat the operations as all being atomic, as no threading is supported
+	*	Note: simply treat the operations as all being atomic, as guest-threads are only switched within syscalls
 	*/
 	gen::MemoryType type = (half ? gen::MemoryType::i32 : gen::MemoryType::i64);
 
@@ -914,7 +2226,7 @@ void rv64::Translate::fMakeAMO(bool half) {
 }
 void rv64::Translate::fMakeAMOLR() {
 	/*
-	*	Note: simply treat the operations as all being atomic, as no threading is supported
+	*	Note: simply treat the operations as all being atomic, as guest-threads are only switched within syscalls
 	*/
 
 	/* operation-checks to simplify the logic */
@@ -945,7 +2257,7 @@ void rv64::Translate::fMakeAMOLR() {
 }
 void rv64::Translate::fMakeAMOSC() {
 	/*
-	*	Note: simply treat the operations as all being atomic, as no threading is supported
+	*	Note: simply treat the operations as all being atomic, as guest-threads are only switched within syscalls
 	*/
 
 	/* operation-checks to simplify the logic */
@@ -1102,7 +2414,7 @@ void rv64::Translate::fMakeCSR() {
 	*
 	*	Currently only the current operations are supported for float csrs
 	*		- float-csr will return last set value but only "round to nearest, ties to even" is implemented
-	*		- float-flags read will only return 0 or last write
+	*		- float-flags are accumulated by the float-operations themselves through the core wasm-helpers
 	*/
 
 	/* fetch the properties about the csr value */
@@ -1163,10 +2475,6 @@ void rv64::Translate::fMakeCSR() {
 	/* fetch the shift and mask properties of the actual csr */
 	auto [shift, mask] = fGetCsrPlacement(pInst->misc);
 
-	/* check if the float read operation is only partially or not implemented */
-	if (read && pInst->misc != csr::fpRoundingMode)
-		gen::Make->invokeVoid(pRegistered.readFloatCsrWarn);
-
 	/* prepare the result writebacks */
 	gen::FulFill csrFulfill = (write ? gen::Make->set(offsetof(rv64::Context, float_csr), gen::MemoryType::i64) : gen::FulFill{});
 	gen::FulFill regFulfill = (read ? fStoreDest() : gen::FulFill{});
@@ -1279,29 +2587,95 @@ void rv64::Translate::fMakeCSR() {
 	gen::Add[I::U64::NotEqual()];
 	{
 		wasm::IfThen _if{ gen::Sink };
-		gen::Add[I::Local::Get(temp)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
+		fMakeFrmWarning(0, temp);
 	}
 
 	/* write the value to the float status-register */
 	csrFulfill.now();
 }
 
-void rv64::Translate::fMakeFLoad(bool multi) const {
+bool rv64::Translate::fMakeClock() {
+	/* check if the syscall is known to be one of the clock-syscalls */
+	uint64_t index = 0;
+	if (!fKnown(reg::A7, index) || (index != Translate::SyscallClockGetTime && index != Translate::SyscallGetTimeOfDay))
+		return false;
+	bool clock = (index == Translate::SyscallClockGetTime);
+	uint8_t output = (clock ? reg::A1 : reg::A0);
+
+	/* fetch the host-time once to ensure both parts are consistent (unavailable while multiple threads exist, as
+	*	they are only switched within actual syscalls, which a thread spinning on the clock must therefore reach) */
+	wasm::Variable stamp = fTempi64(0);
+	pWriter->makeClock();
+	gen::Add[I::Local::Tee(stamp)];
+	gen::Add[I::U64::Const(sys::detail::ClockUnavailable)];
+	gen::Add[I::U64::NotEqual()];
+
+	/* check if the arguments permit the inline handling (realtime or monotonic clock with a time-spec, or a time-value
+	*	without a timezone), and otherwise fall back to performing the actual syscall (which reports null-pointers as faults) */
+	if (clock) {
+		gen::Make->get(offsetof(rv64::Context, iregs) + reg::A0 * sizeof(uint64_t), gen::MemoryType::i64);
+		gen::Add[I::U64::Const(sys::detail::consts::clockMonotonic)];
+		gen::Add[I::U64::LessEqual()];
+		gen::Make->get(offsetof(rv64::Context, iregs) + reg::A1 * sizeof(uint64_t), gen::MemoryType::i64);
+		gen::Add[I::U64::Const(0)];
+		gen::Add[I::U64::NotEqual()];
+		gen::Add[I::U32::And()];
+	}
+	else {
+		gen::Make->get(offsetof(rv64::Context, iregs) + reg::A0 * sizeof(uint64_t), gen::MemoryType::i64);
+		gen::Add[I::U64::Const(0)];
+		gen::Add[I::U64::NotEqual()];
+		gen::Make->get(offsetof(rv64::Context, iregs) + reg::A1 * sizeof(uint64_t), gen::MemoryType::i64);
+		gen::Add[I::U64::EqualZero()];
+		gen::Add[I::U32::And()];
+	}
+	gen::Add[I::U32::And()];
+	wasm::IfThen _if{ gen::Sink };
+
+	/* write the seconds out (memory-faults are raised directly, like a vdso would) */
+	gen::Make->get(offsetof(rv64::Context, iregs) + output * sizeof(uint64_t), gen::MemoryType::i64);
+	gen::Add[I::Local::Get(stamp)];
+	gen::Add[I::U64::Const(1000'000)];
+	gen::Add[I::U64::Div()];
+	gen::Make->write(output, gen::MemoryType::i64, pAddress, pNextAddress);
+
+	/* write the nano-seconds or micro-seconds out */
+	gen::Make->get(offsetof(rv64::Context, iregs) + output * sizeof(uint64_t), gen::MemoryType::i64);
+	gen::Add[I::U64::Const(sizeof(uint64_t))];
+	gen::Add[I::U64::Add()];
+	gen::Add[I::Local::Get(stamp)];
+	gen::Add[I::U64::Const(1000'000)];
+	gen::Add[I::U64::Mod()];
+	if (clock) {
+		gen::Add[I::U64::Const(1000)];
+		gen::Add[I::U64::Mul()];
+	}
+	gen::Make->write(output, gen::MemoryType::i64, pAddress, pNextAddress);
+
+	/* write the successful result back */
+	gen::FulFill fulfill = fStoreReg(reg::A0);
+	gen::Add[I::U64::Const(0)];
+	fulfill.now();
+
+	/* perform the actual syscall */
+	_if.otherwise();
+	fMakeSyscall();
+	return true;
+}
+void rv64::Translate::fMakeSyscall() const {
+	/* pass the syscall-index to the writer, if it is known, to allow simple synchronous syscalls to be performed directly */
+	uint64_t index = 0;
+	pWriter->makeSyscall(pAddress, pNextAddress, fKnown(reg::A7, index) ? rv64::Cpu::MapSyscall(index) : sys::SyscallIndex::unknown);
+}
+
+void rv64::Translate::fMakeFLoad(bool multi) {
+	bool half = (pInst->opcode == rv64::Opcode::load_float || pInst->opcode == rv64::Opcode::multi_load_float);
+
 	/* prepare the result writeback */
-	gen::FulFill fulfill = fStoreFDest(true);
+	gen::FulFill fulfill = fStoreFDest(half);
 
 	/* compute the destination address and write it to the stack */
-	if (multi)
-		gen::Add[I::I64::Const(pAddress + pInst->imm)];
-	else if (pInst->imm != 0) {
-		gen::Add[I::I64::Const(pInst->imm)];
-		if (fLoadSrc1(false, false))
-			gen::Add[I::U64::Add()];
-	}
-	else
-		fLoadSrc1(true, false);
+	fLoadAddress(multi);
 
 	/* check if its a mutli-operation, which requires the intermediate register to be set accordingly (will never be zero) */
 	if (pInst->opcode == rv64::Opcode::multi_load_float || pInst->opcode == rv64::Opcode::multi_load_double) {
@@ -1314,12 +2688,12 @@ void rv64::Translate::fMakeFLoad(bool multi) const {
 	switch (pInst->opcode) {
 	case rv64::Opcode::load_float:
 	case rv64::Opcode::multi_load_float:
-		gen::Make->read(pInst->src1, gen::MemoryType::i32, pAddress);
-		fExpandFloat(true, true);
+		gen::Make->read(pInst->src1, gen::MemoryType::f32, pAddress);
+		fExpandFloat();
 		break;
 	case rv64::Opcode::load_double:
 	case rv64::Opcode::multi_load_double:
-		gen::Make->read(pInst->src1, gen::MemoryType::i64, pAddress);
+		gen::Make->read(pInst->src1, gen::MemoryType::f64, pAddress);
 		break;
 	default:
 		break;
@@ -1330,13 +2704,7 @@ void rv64::Translate::fMakeFLoad(bool multi) const {
 }
 void rv64::Translate::fMakeFStore(bool multi) const {
 	/* compute the destination address and write it to the stack */
-	if (multi)
-		gen::Add[I::I64::Const(pAddress + pInst->imm)];
-	else {
-		gen::Add[I::I64::Const(pInst->imm)];
-		if (fLoadSrc1(false, false))
-			gen::Add[I::U64::Add()];
-	}
+	fLoadAddress(multi);
 
 	/* check if its a mutli-operation, which requires the intermediate register to be set accordingly (will never be zero) */
 	if (pInst->opcode == rv64::Opcode::multi_store_float || pInst->opcode == rv64::Opcode::multi_store_double) {
@@ -1364,11 +2732,13 @@ void rv64::Translate::fMakeFStore(bool multi) const {
 }
 void rv64::Translate::fMakeFloatToInt(bool iHalf, bool fHalf) {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
+
+	/* accumulate the exception flags of the operation (moves do not raise any flags) */
+	bool isConvert = (pInst->opcode != rv64::Opcode::float_move_to_word && pInst->opcode != rv64::Opcode::double_move_to_dword);
+	if (isConvert)
+		fAccumulateFlags();
 
 	/* check if the operation can be discarded */
 	if (pInst->dest == reg::Zero)
@@ -1381,7 +2751,6 @@ void rv64::Translate::fMakeFloatToInt(bool iHalf, bool fHalf) {
 	fLoadFSrc1(fHalf);
 
 	/* either write the maximum value for nan to the stack, or write the actual value to the stack */
-	bool isConvert = (pInst->opcode != rv64::Opcode::float_move_to_word && pInst->opcode != rv64::Opcode::double_move_to_dword);
 	{
 		wasm::IfThen _if;
 		wasm::Variable temp;
@@ -1468,13 +2837,14 @@ void rv64::Translate::fMakeFloatToInt(bool iHalf, bool fHalf) {
 	}
 	fulfill.now();
 }
-void rv64::Translate::fMakeIntToFloat(bool iHalf, bool fHalf) const {
+void rv64::Translate::fMakeIntToFloat(bool iHalf, bool fHalf) {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
+
+	/* accumulate the exception flags of the operation (moves do not raise any flags) */
+	if (pInst->opcode != rv64::Opcode::float_move_from_word && pInst->opcode != rv64::Opcode::double_move_from_dword)
+		fAccumulateFlags();
 
 	/* prepare the result writeback */
 	gen::FulFill fulfill = fStoreFDest(fHalf);
@@ -1520,16 +2890,16 @@ void rv64::Translate::fMakeIntToFloat(bool iHalf, bool fHalf) const {
 
 	/* perform the float extension and write the result back */
 	if (fHalf)
-		fExpandFloat(false, true);
+		fExpandFloat();
 	fulfill.now();
 }
-void rv64::Translate::fMakeFloatALUSimple(bool half) const {
+void rv64::Translate::fMakeFloatALUSimple(bool half) {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
+
+	/* accumulate the exception flags of the operation */
+	fAccumulateFlags();
 
 	/* prepare the result writeback */
 	gen::FulFill fulfill = fStoreFDest(half);
@@ -1582,16 +2952,16 @@ void rv64::Translate::fMakeFloatALUSimple(bool half) const {
 
 	/* perform the float extension and write the result back */
 	if (half)
-		fExpandFloat(false, true);
+		fExpandFloat();
 	fulfill.now();
 }
-void rv64::Translate::fMakeFloatALULarge(bool half) const {
+void rv64::Translate::fMakeFloatALULarge(bool half) {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
+
+	/* accumulate the exception flags of the operation */
+	fAccumulateFlags();
 
 	/* prepare the result writeback */
 	gen::FulFill fulfill = fStoreFDest(half);
@@ -1661,16 +3031,16 @@ void rv64::Translate::fMakeFloatALULarge(bool half) const {
 
 	/* perform the float extension and write the result back */
 	if (half)
-		fExpandFloat(false, true);
+		fExpandFloat();
 	fulfill.now();
 }
-void rv64::Translate::fMakeFloatConvert() const {
+void rv64::Translate::fMakeFloatConvert() {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
+
+	/* accumulate the exception flags of the operation */
+	fAccumulateFlags();
 
 	/* prepare the result writeback */
 	gen::FulFill fulfill = fStoreFDest(pInst->opcode == rv64::Opcode::double_to_float);
@@ -1686,22 +3056,19 @@ void rv64::Translate::fMakeFloatConvert() const {
 
 	/* perform the float extension and write the result back */
 	if (pInst->opcode == rv64::Opcode::double_to_float)
-		fExpandFloat(false, true);
+		fExpandFloat();
 	fulfill.now();
 }
-void rv64::Translate::fMakeFloatSign(bool half) const {
+void rv64::Translate::fMakeFloatSign(bool half) {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
 
 	/* check if the result will already be an integer */
 	bool toInt = (pInst->opcode == rv64::Opcode::float_sign_xor || pInst->opcode == rv64::Opcode::double_sign_xor);
 
 	/* prepare the result writeback */
-	gen::FulFill fulfill = fStoreFDest(half || toInt);
+	gen::FulFill fulfill = fStoreFDest(half);
 
 	/* fetch the source operands and check if the first operand needs to be converted to an integer */
 	fLoadFSrc1(half);
@@ -1724,6 +3091,7 @@ void rv64::Translate::fMakeFloatSign(bool half) const {
 		gen::Add[I::U32::Const(uint64_t(1) << 31)];
 		gen::Add[I::U32::And()];
 		gen::Add[I::U32::XOr()];
+		gen::Add[I::U32::AsFloat()];
 		break;
 	case rv64::Opcode::double_sign_copy:
 		gen::Add[I::F64::CopySign()];
@@ -1738,6 +3106,7 @@ void rv64::Translate::fMakeFloatSign(bool half) const {
 		gen::Add[I::U64::Const(uint64_t(1) << 63)];
 		gen::Add[I::U64::And()];
 		gen::Add[I::U64::XOr()];
+		gen::Add[I::U64::AsFloat()];
 		break;
 	default:
 		break;
@@ -1745,16 +3114,16 @@ void rv64::Translate::fMakeFloatSign(bool half) const {
 
 	/* perform the float extension and write the result back */
 	if (half)
-		fExpandFloat(toInt, true);
+		fExpandFloat();
 	fulfill.now();
 }
 void rv64::Translate::fMakeFloatCompare(bool half) const {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
+
+	/* accumulate the exception flags of the operation */
+	fAccumulateFlags();
 
 	/* prepare the result writeback */
 	gen::FulFill fulfill = fStoreDest();
@@ -1791,13 +3160,14 @@ void rv64::Translate::fMakeFloatCompare(bool half) const {
 	gen::Add[I::U32::Expand()];
 	fulfill.now();
 }
-void rv64::Translate::fMakeFloatUnary(bool half, bool intResult) const {
+void rv64::Translate::fMakeFloatUnary(bool half, bool intResult) {
 	/* check if the frm is supported */
-	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding) {
-		gen::Add[I::I64::Const(-pInst->misc)];
-		gen::Make->invokeParam(pRegistered.frmFloatCsrWarn);
-		gen::Add[I::Drop()];
-	}
+	if (pInst->misc != frm::roundNearestTiesToEven && pInst->misc != frm::dynamicRounding)
+		fMakeFrmWarning(-int64_t(pInst->misc), {});
+
+	/* accumulate the exception flags of the operation (classification does not raise any flags) */
+	if (!intResult)
+		fAccumulateFlags();
 
 	/* prepare the result writeback */
 	gen::FulFill fulfill = (intResult ? fStoreDest() : fStoreFDest(half));
@@ -1816,11 +3186,13 @@ void rv64::Translate::fMakeFloatUnary(bool half, bool intResult) const {
 	case rv64::Opcode::float_classify:
 		gen::Add[I::F32::AsInt()];
 		gen::Add[I::U32::Expand()];
-		gen::Make->invokeParam(pRegistered.classify32Bit);
+		gen::Add[I::Call::Direct(pHelper.classify32Bit)];
+		gen::Add[I::U32::Expand()];
 		break;
 	case rv64::Opcode::double_classify:
 		gen::Add[I::F64::AsInt()];
-		gen::Make->invokeParam(pRegistered.classify64Bit);
+		gen::Add[I::Call::Direct(pHelper.classify64Bit)];
+		gen::Add[I::U32::Expand()];
 		break;
 	default:
 		break;
@@ -1828,43 +3200,91 @@ void rv64::Translate::fMakeFloatUnary(bool half, bool intResult) const {
 
 	/* perform the float extension and write the result back */
 	if (half && !intResult)
-		fExpandFloat(false, true);
+		fExpandFloat();
 	fulfill.now();
 }
 
-bool rv64::Translate::setup() {
-	/* register the callbacks */
-	pRegistered.classify32Bit = env::Instance()->interact().defineCallback([](uint64_t value) -> uint64_t {
-		return fClassifyf32(std::bit_cast<float, uint32_t>(uint32_t(value)));
-		});
-	pRegistered.classify64Bit = env::Instance()->interact().defineCallback([](uint64_t value) -> uint64_t {
-		return fClassifyf64(std::bit_cast<double, uint64_t>(value));
-		});
-	pRegistered.readFloatCsrWarn = env::Instance()->interact().defineCallback([this]() {
-		if (!pReadCsrShown)
-			logger.warn(u8"Reading csr::float");
-		pReadCsrShown = true;
-		});
-	pRegistered.frmFloatCsrWarn = env::Instance()->interact().defineCallback([this](int64_t value) -> uint64_t {
-		if (pFrmFloatShown)
-			return 0;
-		pFrmFloatShown = true;
+bool rv64::Translate::setupCore() {
+	/* register the callbacks (only for operations, which actually require the host) */
+	pRegistered.frmFloatCsrWarn = env::Instance()->interact().defineCallback([](int64_t value) -> uint64_t {
 		if (value < 0)
 			logger.warn(u8"Unsupported frm used in float instruction [", str::As{ U"03b", -value }, u8']');
 		else
 			logger.warn(u8"Setting csr::float::frm to unsupported [", str::As{ U"03b", value }, u8']');
 		return 0;
 		});
+
+	/* add the pure wasm-helpers to the core and bind them to be imported by the blocks */
+	fDefineClassify(true);
+	fDefineClassify(false);
+	env::Instance()->bindExport(u8"rv64_classify_f32");
+	env::Instance()->bindExport(u8"rv64_classify_f64");
+
+	/* add the float-flag helpers to the core and bind them to be imported by the blocks */
+	std::vector<wasm::Prototype> prototypes = FlagPrototypes();
+	fDefineFlags(true, prototypes, pHelper.flags32);
+	fDefineFlags(false, prototypes, pHelper.flags64);
+	fDefineNarrowFlags(prototypes);
+	for (size_t i = 0; i < size_t(FlagHelper::_end); ++i) {
+		env::Instance()->bindExport(fFlagHelper(FlagHelper(i), true).first);
+		env::Instance()->bindExport(fFlagHelper(FlagHelper(i), false).first);
+	}
+	env::Instance()->bindExport(u8"rv64_flags_narrow");
+
+	/* add the helper to ensure the frm-warning is only passed to the host once */
+	{
+		wasm::Global shown = gen::Module->global(u8"rv64_frm_shown", wasm::Type::i32, true);
+		gen::Module->value(shown, wasm::Value::MakeU32(0));
+
+		wasm::Prototype prototype = gen::Module->prototype(u8"rv64_frm_first_type", {}, { wasm::Type::i32 });
+		wasm::Sink sink{ gen::Module->function(u8"rv64_frm_first", prototype, wasm::Export{}) };
+		sink[I::Global::Get(shown)];
+		{
+			wasm::IfThen _if{ sink };
+			sink[I::U32::Const(0)];
+			sink[I::Return()];
+		}
+		sink[I::U32::Const(1)];
+		sink[I::Global::Set(shown)];
+		sink[I::U32::Const(1)];
+	}
+	env::Instance()->bindExport(u8"rv64_frm_first");
 	return true;
 }
+void rv64::Translate::setupBlock() {
+	const std::u8string& name = env::Instance()->blockImportModule();
+
+	/* import the pure wasm-helpers of the core */
+	wasm::Prototype prototype = gen::Module->prototype(u8"rv64_classify_f32_type", { { u8"value", wasm::Type::i64 } }, { wasm::Type::i32 });
+	pHelper.classify32Bit = gen::Module->function(u8"rv64_classify_f32", prototype, wasm::Import{ name });
+	prototype = gen::Module->prototype(u8"rv64_classify_f64_type", { { u8"value", wasm::Type::i64 } }, { wasm::Type::i32 });
+	pHelper.classify64Bit = gen::Module->function(u8"rv64_classify_f64", prototype, wasm::Import{ name });
+	prototype = gen::Module->prototype(u8"rv64_frm_first_type", {}, { wasm::Type::i32 });
+	pHelper.frmFirst = gen::Module->function(u8"rv64_frm_first", prototype, wasm::Import{ name });
+
+	/* import the float-flag helpers of the core */
+	std::vector<wasm::Prototype> prototypes = FlagPrototypes();
+	for (size_t i = 0; i < size_t(FlagHelper::_end); ++i) {
+		auto [name32, params32] = fFlagHelper(FlagHelper(i), true);
+		pHelper.flags32[i] = gen::Module->function(name32, prototypes[params32 - 1], wasm::Import{ name });
+		auto [name64, params64] = fFlagHelper(FlagHelper(i), false);
+		pHelper.flags64[i] = gen::Module->function(name64, prototypes[params64 - 1], wasm::Import{ name });
+	}
+	pHelper.narrowFlags = gen::Module->function(u8"rv64_flags_narrow", prototypes[0], wasm::Import{ name });
+}
 void rv64::Translate::resetAll(sys::Writer* writer) {
 	for (wasm::Variable& var : pTemp)
 		var = wasm::Variable{};
+	for (wasm::Variable& var : pFloatLocals)
+		var = wasm::Variable{};
 	pWriter = writer;
 }
 void rv64::Translate::start(env::guest_t address) {
 	pAddress = address;
 	pNextAddress = address;
+
+	/* reset the known register values, as the chunk might be entered from anywhere */
+	fResetValues();
 }
 void rv64::Translate::next(const rv64::Instruction& inst) {
 	/* setup the state for the upcoming instruction */
@@ -1974,7 +3394,8 @@ void rv64::Translate::next(const rv64::Instruction& inst) {
 		fMakeStore(true);
 		break;
 	case rv64::Opcode::ecall:
-		pWriter->makeSyscall(pAddress, pNextAddress);
+		if (!fMakeClock())
+			fMakeSyscall();
 		break;
 	case rv64::Opcode::ebreak:
 		pWriter->makeException(Translate::EBreakException, pAddress, pNextAddress);
@@ -2160,4 +3581,7 @@ void rv64::Translate::next(const rv64::Instruction& inst) {
 		pWriter->makeException(Translate::NotImplException, pAddress, pNextAddress);
 		break;
 	}
+
+	/* update the known register values with the effects of the instruction */
+	fUpdateValues();
 }
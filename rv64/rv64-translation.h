@@ -5,7 +5,10 @@
 #include "rv64-common.h"
 
 namespace rv64 {
-	/* performs primitive macro-expansion-like translation currently for single-threaded userspace processes */
+	/* performs primitive macro-expansion-like translation currently for single-threaded userspace processes
+	*	Note: tracks constant and copied register values across the instructions of a single chunk
+	*	Note: keeps NaN-boxed single-precision registers of a chunk as raw f32 in locals
+	*	Note: performs clock-syscalls with a known syscall-index inline (similar to a vdso) */
 	class Translate {
 	public:
 		static constexpr uint64_t EBreakException = 0;
@@ -14,20 +17,54 @@ namespace rv64 {
 		static constexpr uint64_t CsrUnsupported = 3;
 		static constexpr uint64_t NotImplException = 4;
 
+		/* syscalls, which are performed inline without entering the syscall-handling (if the arguments permit it) */
+		static constexpr uint64_t SyscallGetTimeOfDay = 169;
+		static constexpr uint64_t SyscallClockGetTime = 113;
+
+	private:
+		enum class FlagHelper : uint8_t {
+			add,
+			mul,
+			fused,
+			div,
+			sqrt,
+			signaling,
+			compare,
+			toInt,
+			fromInt,
+			_end
+		};
+		enum class ValueState : uint8_t {
+			unknown,
+			constant,
+			copy
+		};
+		struct RegValue {
+			uint64_t value = 0;
+			uint8_t reg = 0;
+			ValueState state = ValueState::unknown;
+		};
+
 	private:
 		wasm::Variable pTemp[8];
+		RegValue pValues[32];
+		wasm::Variable pFloatLocals[32];
+		bool pFloatCached[32] = { false };
 		sys::Writer* pWriter = 0;
 		const rv64::Instruction* pInst = 0;
 		env::guest_t pAddress = 0;
 		env::guest_t pNextAddress = 0;
 		struct {
-			uint32_t classify32Bit = 0;
-			uint32_t classify64Bit = 0;
-			uint32_t readFloatCsrWarn = 0;
 			uint32_t frmFloatCsrWarn = 0;
 		} pRegistered;
-		bool pReadCsrShown = false;
-		bool pFrmFloatShown = false;
+		struct {
+			wasm::Function classify32Bit;
+			wasm::Function classify64Bit;
+			wasm::Function frmFirst;
+			wasm::Function flags32[size_t(FlagHelper::_end)];
+			wasm::Function flags64[size_t(FlagHelper::_end)];
+			wasm::Function narrowFlags;
+		} pHelper;
 
 	public:
 		Translate() = default;
@@ -40,22 +77,39 @@ namespace rv64 {
 		wasm::Variable fTempf64();
 
 	private:
-		static uint32_t fClassifyFloat(int _class, bool _sign, bool _topMantissa);
-		static uint32_t fClassifyf32(float value);
-		static uint32_t fClassifyf64(double value);
+		static void fDefineClassify(bool half);
+		static std::pair<std::u8string, size_t> fFlagHelper(FlagHelper helper, bool half);
+		static void fDefineFlags(bool half, const std::vector<wasm::Prototype>& prototypes, wasm::Function* functions);
+		static void fDefineNarrowFlags(const std::vector<wasm::Prototype>& prototypes);
+
+	private:
+		static bool fCompare(rv64::Opcode opcode, uint64_t a, uint64_t b);
+		bool fKnown(uint8_t reg, uint64_t& value) const;
+		uint8_t fResolve(uint8_t reg) const;
+		bool fEvaluate(uint64_t& value) const;
+		void fSetUnknown(uint8_t reg);
+		void fSetConstant(uint8_t reg, uint64_t value);
+		void fSetCopy(uint8_t reg, uint8_t src);
+		void fResetValues();
+		void fUpdateValues();
 
 	private:
 		bool fLoadSrc1(bool forceNull, bool half) const;
 		bool fLoadSrc2(bool forceNull, bool half) const;
 		gen::FulFill fStoreReg(uint8_t reg) const;
 		gen::FulFill fStoreDest() const;
+		void fLoadAddress(bool multi) const;
+		bool fMakeKnownResult() const;
 
 	private:
+		void fLoadFReg(uint8_t reg, bool half) const;
 		void fLoadFSrc1(bool half) const;
 		void fLoadFSrc2(bool half) const;
 		void fLoadFSrc3(bool half) const;
-		gen::FulFill fStoreFDest(bool isAsInt) const;
-		void fExpandFloat(bool isAsInt, bool leaveAsInt) const;
+		gen::FulFill fStoreFDest(bool half);
+		void fExpandFloat();
+		void fAccumulateFlags() const;
+		void fMakeFrmWarning(int64_t value, const wasm::Variable& var) const;
 
 	private:
 		void fMakeImms() const;
@@ -72,21 +126,24 @@ namespace rv64 {
 		void fMakeAMOSC();
 		void fMakeMul();
 		void fMakeCSR();
+		bool fMakeClock();
+		void fMakeSyscall() const;
 
 	private:
-		void fMakeFLoad(bool multi) const;
+		void fMakeFLoad(bool multi);
 		void fMakeFStore(bool multi) const;
 		void fMakeFloatToInt(bool iHalf, bool fHalf);
-		void fMakeIntToFloat(bool iHalf, bool fHalf) const;
-		void fMakeFloatALUSimple(bool half) const;
-		void fMakeFloatALULarge(bool half) const;
-		void fMakeFloatConvert() const;
-		void fMakeFloatSign(bool half) const;
+		void fMakeIntToFloat(bool iHalf, bool fHalf);
+		void fMakeFloatALUSimple(bool half);
+		void fMakeFloatALULarge(bool half);
+		void fMakeFloatConvert();
+		void fMakeFloatSign(bool half);
 		void fMakeFloatCompare(bool half) const;
-		void fMakeFloatUnary(bool half, bool intResult) const;
+		void fMakeFloatUnary(bool half, bool intResult);
 
 	public:
-		bool setup();
+		bool setupCore();
+		void setupBlock();
 		void resetAll(sys::Writer* writer);
 		void start(env::guest_t address);
 		void next(const rv64::Instruction& inst);
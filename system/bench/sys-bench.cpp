@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include "../system.h"
+
+static util::Logger logger{ u8"sys::bench" };
+
+static uint64_t StampNS() {
+	return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool sys::TranslateBench::fTranslate(env::guest_t address, sys::BenchResult& result, std::unordered_set<env::guest_t>& translated) const {
+	try {
+		wasm::BinaryWriter writer;
+		wasm::Module mod{ &writer };
+
+		/* setup the translator and translate the root and all addresses reachable within the translation-depth */
+		gen::Block translator{ mod };
+		pCpu->setupBlock(mod);
+		translator.run(address);
+
+		/* finalize the translation (closes the module and thereby produces the final binary) */
+		uint64_t stamp = StampNS();
+		std::vector<env::BlockExport> exports = translator.close();
+		result.emitNS += StampNS() - stamp;
+		result.wasmBytes += writer.output().size();
+
+		/* mark all translated addresses to not be used as roots again */
+		for (const env::BlockExport& block : exports)
+			translated.insert(block.address);
+	}
+	catch (const wasm::Exception& e) {
+		logger.error(u8"WASM exception occurred while translating [", str::As{ U"#018x", address }, u8"]: ", e.what());
+		return false;
+	}
+	return true;
+}
+bool sys::TranslateBench::fRun(sys::BenchResult& result) {
+	if (!pLoaded)
+		return false;
+	logger.info(u8"Translating [", pRoots.size(), u8"] roots...");
+
+	/* attach the statistics to the generator and translate all roots */
+	std::unordered_set<env::guest_t> translated;
+	gen::Statistics* previous = gen::Instance()->setStatistics(&result.statistics);
+	uint64_t start = StampNS();
+	bool success = true;
+	for (env::guest_t root : pRoots) {
+		if (translated.contains(root))
+			continue;
+		success = fTranslate(root, result, translated);
+		if (!success)
+			break;
+	}
+	result.totalNS = StampNS() - start;
+	gen::Instance()->setStatistics(previous);
+	return success;
+}
+
+bool sys::TranslateBench::Run(std::unique_ptr<sys::Cpu>&& cpu, std::vector<uint8_t>&& data, sys::BenchResult& result) {
+	std::unique_ptr<sys::TranslateBench> system{ new sys::TranslateBench() };
+	sys::TranslateBench* _this = system.get();
+	_this->pCpu = cpu.get();
+	_this->pData = std::move(data);
+
+	/* setup the cpu and the process (core is loaded inplace, which will also map the elf) */
+	if (!_this->pCpu->setupCpu(&_this->pWriter)) {
+		logger.error(u8"Failed to setup cpu [", _this->pCpu->name(), u8"] for benchmarking");
+		return false;
+	}
+	uint32_t memoryCaches = _this->pCpu->memoryCaches(), contextSize = _this->pCpu->contextSize();
+	bool detectWriteExecute = _this->pCpu->detectWriteExecute();
+	if (!gen::SetInstance(std::move(cpu), sys::DefTranslationDepth, gen::TraceType::none, {}))
+		return false;
+	if (!env::SetInstance(std::move(system), detail::PageSize, memoryCaches, contextSize, detectWriteExecute, false)) {
+		gen::ClearInstance();
+		return false;
+	}
+
+	/* perform the actual benchmark and release the process */
+	bool success = _this->fRun(result);
+	env::Instance()->shutdown();
+	return success;
+}
+
+bool sys::TranslateBench::setupCore(wasm::Module& mod) {
+	/* setup the actual core */
+	gen::Core core{ mod };
+
+	/* setup the writer object (syscalls will never be executed) */
+	if (!pWriter.fSetup(0)) {
+		logger.error(u8"Failed to setup the benchmark-writer");
+		return false;
+	}
+
+	/* perform the cpu-configuration of the core */
+	if (!pCpu->setupCore(mod))
+		return false;
+
+	/* finalize the actual core */
+	return core.close();
+}
+void sys::TranslateBench::coreLoaded() {
+	try {
+		elf::LoadState loaded = sys::LoadElf(pData.data(), pData.size(), std::nullopt);
+		if (!loaded.interpreter.empty())
+			logger.warn(u8"Interpreter [", loaded.interpreter, u8"] is ignored and only the binary itself is translated");
+
+		/* collect all roots (the entry-point and all function-symbols) */
+		pRoots.push_back(loaded.start);
+		for (const elf::Symbol& symbol : sys::ReadElfSymbols(pData.data(), pData.size(), loaded.base))
+			pRoots.push_back(symbol.address);
+		pLoaded = true;
+	}
+	catch (const elf::Exception& e) {
+		logger.error(u8"Failed to load elf: ", e.what());
+	}
+}
+std::vector<env::BlockExport> sys::TranslateBench::setupBlock(wasm::Module& mod) {
+	logger.fatal(u8"Benchmark does not load any blocks");
+	return {};
+}
+const env::WarmBlock* sys::TranslateBench::warmBlock() {
+	return 0;
+}
+void sys::TranslateBench::blockProduced(const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports) {}
+void sys::TranslateBench::blockLoaded() {}
+void sys::TranslateBench::shutdown() {
+	/* clearing the system-reference will also release this object */
+	gen::ClearInstance();
+	env::ClearInstance();
+}
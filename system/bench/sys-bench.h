@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "../sys-common.h"
+
+#include "../sys-cpu.h"
+#include "../writer/sys-writer.h"
+#include "../elf/sys-elf.h"
+#include "../userspace/sys-userspace.h"
+
+namespace sys {
+	struct BenchResult {
+		gen::Statistics statistics;
+		uint64_t wasmBytes = 0;
+		uint64_t emitNS = 0;
+		uint64_t totalNS = 0;
+	};
+
+	/* native translation-benchmark system, which maps an elf file into the environment and translates
+	*	all reachable addresses of its executable sections without ever loading or executing any blocks
+	*	Note: requires the host to complete all tasks inplace (such as the null-interface)
+	*	Note: roots are the entry-point and all function-symbols of the elf (if not stripped) */
+	class TranslateBench final : public env::System {
+	private:
+		std::vector<env::guest_t> pRoots;
+		std::vector<uint8_t> pData;
+		sys::Writer pWriter;
+		sys::Cpu* pCpu = 0;
+		bool pLoaded = false;
+
+	private:
+		TranslateBench() = default;
+		TranslateBench(sys::TranslateBench&&) = delete;
+		TranslateBench(const sys::TranslateBench&) = delete;
+
+	private:
+		bool fTranslate(env::guest_t address, sys::BenchResult& result, std::unordered_set<env::guest_t>& translated) const;
+		bool fRun(sys::BenchResult& result);
+
+	public:
+		static bool Run(std::unique_ptr<sys::Cpu>&& cpu, std::vector<uint8_t>&& data, sys::BenchResult& result);
+
+	public:
+		bool setupCore(wasm::Module& mod) final;
+		void coreLoaded() final;
+		std::vector<env::BlockExport> setupBlock(wasm::Module& mod) final;
+		const env::WarmBlock* warmBlock() final;
+		void blockProduced(const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports) final;
+		void blockLoaded() final;
+		void shutdown() final;
+	};
+}
@@ -19,6 +19,13 @@ namespace sys {
 			riscv = 243
 		};
 
+		/* file backing the elf-data, in which case the data only need to contain the headers, and the
+		*	segments are populated lazily from the file (requires file-tasks to be completed in-place) */
+		struct FileBacking {
+			uint64_t id = 0;
+			uint64_t size = 0;
+		};
+
 		/* load-state describing the result of the load-operation */
 		struct LoadState {
 			std::u8string interpreter;
@@ -32,11 +39,19 @@ namespace sys {
 			} aux;
 			env::guest_t endOfData = 0;
 			env::guest_t start = 0;
+			env::guest_t base = 0;
 			elf::MachineType machine = elf::MachineType::none;
 			uint8_t bitWidth = 0;
 
 		};
 
+		/* function-symbol of a section containing instructions */
+		struct Symbol {
+			std::u8string name;
+			env::guest_t address = 0;
+			uint64_t size = 0;
+		};
+
 		/* exception thrown for any issues regarding elf-file parsing/loading */
 		struct Exception : public str::u8::BuildException {
 			template <class... Args>
@@ -166,6 +181,31 @@ namespace sys {
 			Base entrySize;
 		};
 
+		namespace symbolType {
+			static constexpr uint8_t mask = 0x0f;
+			static constexpr uint8_t object = 1;
+			static constexpr uint8_t function = 2;
+		}
+
+		struct SymbolEntry32 {
+			uint32_t name;
+			uint32_t value;
+			uint32_t size;
+			uint8_t info;
+			uint8_t other;
+			uint16_t sectionIndex;
+		};
+		struct SymbolEntry64 {
+			uint32_t name;
+			uint8_t info;
+			uint8_t other;
+			uint16_t sectionIndex;
+			uint64_t value;
+			uint64_t size;
+		};
+		template <class Base>
+		using SymbolEntry = std::conditional_t<std::is_same_v<Base, uint64_t>, detail::SymbolEntry64, detail::SymbolEntry32>;
+
 		class Reader {
 		private:
 			const uint8_t* pData = 0;
@@ -4,7 +4,7 @@
 
 static util::Logger logger{ u8"sys::elf" };
 
-sys::elf::LoadState sys::LoadElf(const uint8_t* data, size_t size) {
+sys::elf::LoadState sys::LoadElf(const uint8_t* data, size_t size, std::optional<elf::FileBacking> backing) {
 	detail::Reader reader{ data, size };
 
 	/* validate the fundamental elf-signature */
@@ -23,12 +23,13 @@ sys::elf::LoadState sys::LoadElf(const uint8_t* data, size_t size) {
 	logger.debug(u8"Selecting base-address as: ", str::As{ U"#018x", baseAddress });
 
 	/* load all program headers to memory */
-	detail::LoadElfProgHeaders(baseAddress, config, reader, bitWidth);
+	detail::LoadElfProgHeaders(baseAddress, config, reader, backing, bitWidth);
 
 	/* setup the loaded state */
 	elf::LoadState loaded;
 	std::swap(loaded.interpreter, config.interpreter);
 	loaded.start = config.entry + baseAddress;
+	loaded.base = baseAddress;
 	loaded.endOfData = config.endOfData;
 	loaded.machine = config.machine;
 	loaded.bitWidth = bitWidth;
@@ -41,7 +42,7 @@ sys::elf::LoadState sys::LoadElf(const uint8_t* data, size_t size) {
 	return loaded;
 }
 
-void sys::LoadElfInterpreter(elf::LoadState& state, const uint8_t* data, size_t size) {
+void sys::LoadElfInterpreter(elf::LoadState& state, const uint8_t* data, size_t size, std::optional<elf::FileBacking> backing) {
 	detail::Reader reader{ data, size };
 
 	/* validate the fundamental elf-signature */
@@ -74,9 +75,42 @@ void sys::LoadElfInterpreter(elf::LoadState& state, const uint8_t* data, size_t
 	logger.debug(u8"Selecting base-address for interpreter as: ", str::As{ U"#018x", baseAddress });
 
 	/* load all program headers to memory (discard end-of-data, as the previous end-of-data value is being used) */
-	detail::LoadElfProgHeaders(baseAddress, config, reader, bitWidth);
+	detail::LoadElfProgHeaders(baseAddress, config, reader, backing, bitWidth);
 
 	/* patch the final state */
 	state.aux.base = baseAddress;
 	state.start = config.entry + baseAddress;
 }
+
+sys::elf::LoadState sys::ProbeElf(const uint8_t* data, size_t size) {
+	detail::Reader reader{ data, size };
+
+	/* validate the fundamental elf-signature */
+	uint8_t bitWidth = detail::CheckElfSignature(reader);
+	if (bitWidth == 0)
+		throw elf::Exception{ u8"Data do not have a valid elf-signature" };
+
+	/* validate the initial elf header and all of the program headers */
+	detail::ElfConfig config = detail::ValidateElfLoad(reader, bitWidth);
+
+	/* setup the probed state */
+	elf::LoadState probed;
+	std::swap(probed.interpreter, config.interpreter);
+	probed.machine = config.machine;
+	probed.bitWidth = bitWidth;
+	return probed;
+}
+
+std::vector<sys::elf::Symbol> sys::ReadElfSymbols(const uint8_t* data, size_t size, env::guest_t baseAddress) {
+	detail::Reader reader{ data, size };
+
+	/* validate the fundamental elf-signature */
+	uint8_t bitWidth = detail::CheckElfSignature(reader);
+	if (bitWidth == 0)
+		throw elf::Exception{ u8"Data do not have a valid elf-signature" };
+
+	/* collect the symbols */
+	std::vector<elf::Symbol> symbols;
+	detail::ReadElfSymbols(reader, baseAddress, symbols, bitWidth);
+	return symbols;
+}
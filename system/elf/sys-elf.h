@@ -7,9 +7,15 @@
 
 namespace sys {
 	/* load the elf-file into the current environment (requires env::Process to be set-up) */
-	elf::LoadState LoadElf(const uint8_t* data, size_t size);
+	elf::LoadState LoadElf(const uint8_t* data, size_t size, std::optional<elf::FileBacking> backing);
 
 	/* continue loading of elf after the requested interpreter has been fetched
 	*	(requires initial sys::LoadElf call with a non-empty interpreter path) */
-	void LoadElfInterpreter(elf::LoadState& state, const uint8_t* data, size_t size);
+	void LoadElfInterpreter(elf::LoadState& state, const uint8_t* data, size_t size, std::optional<elf::FileBacking> backing);
+
+	/* validate the elf-file without loading it into the environment (only populates the interpreter, machine, and bit-width) */
+	elf::LoadState ProbeElf(const uint8_t* data, size_t size);
+
+	/* read all function-symbols from the symbol-tables of the elf-file, relocated by the base-address (empty if stripped) */
+	std::vector<elf::Symbol> ReadElfSymbols(const uint8_t* data, size_t size, env::guest_t baseAddress);
 }
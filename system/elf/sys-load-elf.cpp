@@ -90,7 +90,7 @@ sys::detail::ElfConfig sys::detail::ValidateElfLoadTyped(const detail::Reader& r
 }
 
 template <class Base>
-env::guest_t sys::detail::LoadElfSingleProgHeader(env::guest_t baseAddress, size_t index, const detail::ProgramHeader<Base>& header, const detail::Reader& reader) {
+env::guest_t sys::detail::LoadElfSingleProgHeader(env::guest_t baseAddress, size_t index, const detail::ProgramHeader<Base>& header, const detail::Reader& reader, const std::optional<elf::FileBacking>& backing) {
 	env::guest_t pageSize = env::Instance()->pageSize();
 
 	/* validate the alignment */
@@ -124,23 +124,84 @@ env::guest_t sys::detail::LoadElfSingleProgHeader(env::guest_t baseAddress, size
 	if (!env::Instance()->memory().mmap(address, size, usage))
 		throw elf::Exception{ u8"Failed to allocate memory for program-header [", index, u8']' };
 
-	/* write the actual data to the section (no usage to ensure it cannot fail - as the flags have already been applied) */
-	const uint8_t* data = reader.base<uint8_t>(header.offset, header.fileSize);
-	env::Instance()->memory().mwrite(virtAddress, data, header.fileSize, env::Usage::None);
+	/* check if the data are contained in the elf-data, in which case they can just be written to the section
+	*	(no usage to ensure it cannot fail - as the flags have already been applied) */
+	if (!backing.has_value()) {
+		const uint8_t* data = reader.base<uint8_t>(header.offset, header.fileSize);
+		env::Instance()->memory().mwrite(virtAddress, data, header.fileSize, env::Usage::None);
+		return (address + size);
+	}
+	if (header.offset + header.fileSize < header.offset || header.offset + header.fileSize > backing->size)
+		throw elf::Exception{ u8"Cannot read [", header.offset + header.fileSize, u8"] bytes from elf of size [", backing->size, u8']' };
+	if (header.fileSize == 0)
+		return (address + size);
+
+	/* check if the file-offset is not congruent to the address, in which case the pages cannot be populated from the file */
+	env::guest_t inset = (virtAddress - address);
+	if (header.offset < inset || ((header.offset - inset) & (pageSize - 1)) != 0) {
+		std::vector<uint8_t> buffer(header.fileSize);
+		detail::ReadElfBacking(*backing, header.offset, buffer.data(), buffer.size());
+		env::Instance()->memory().mwrite(virtAddress, buffer.data(), buffer.size(), env::Usage::None);
+		return (address + size);
+	}
+
+	/* populate all pages lazily from the file (leading bytes of the first page are populated from the file as well) and
+	*	clear the remainder of the last page, which will populate it immediately (written pages are private to the guest) */
+	env::guest_t endOfFile = virtAddress + header.fileSize, endOfPages = ((endOfFile + pageSize - 1) & ~(pageSize - 1));
+	env::Instance()->memory().mlazy(address, endOfPages - address, backing->id, header.offset - inset);
+	if (endOfFile < endOfPages)
+		env::Instance()->memory().mclear(endOfFile, endOfPages - endOfFile, env::Usage::None);
 
 	/* return the end-of-data address */
 	return (address + size);
 }
 
 template <class Base>
-void sys::detail::LoadElfProgHeadersTyped(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader) {
+void sys::detail::LoadElfProgHeadersTyped(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader, const std::optional<elf::FileBacking>& backing) {
 	/* extract the list of program-headers */
 	const detail::ProgramHeader<Base>* phList = reader.base<detail::ProgramHeader<Base>>(config.phOffset, config.phCount);
 
 	/* iterate over the headers and load them and accumulate the end-of-data address */
 	for (size_t i = 0; i < config.phCount; ++i) {
 		if (phList[i].type == detail::ProgramType::load)
-			config.endOfData = std::max<env::guest_t>(config.endOfData, detail::LoadElfSingleProgHeader<Base>(baseAddress, i, phList[i], reader));
+			config.endOfData = std::max<env::guest_t>(config.endOfData, detail::LoadElfSingleProgHeader<Base>(baseAddress, i, phList[i], reader, backing));
+	}
+}
+
+template <class Base>
+void sys::detail::ReadElfSymbolsTyped(const detail::Reader& reader, env::guest_t baseAddress, std::vector<elf::Symbol>& symbols) {
+	const detail::ElfHeader<Base>* header = reader.get<detail::ElfHeader<Base>>(0);
+
+	/* check if the section-headers can be used to lookup the symbols */
+	if (header->shOffset == 0 || header->shCount == 0 || header->shEntrySize != sizeof(detail::SectionHeader<Base>))
+		return;
+	const detail::SectionHeader<Base>* shList = reader.base<detail::SectionHeader<Base>>(header->shOffset, header->shCount);
+
+	/* iterate over all symbol-tables and collect the function-symbols of sections containing instructions */
+	for (size_t i = 0; i < header->shCount; ++i) {
+		if (shList[i].type != detail::SectionType::symbolTable && shList[i].type != detail::SectionType::dynamicSymbols)
+			continue;
+		if (shList[i].entrySize != sizeof(detail::SymbolEntry<Base>) || shList[i].link >= header->shCount)
+			continue;
+		size_t count = size_t(shList[i].size / shList[i].entrySize);
+		const detail::SymbolEntry<Base>* entries = reader.base<detail::SymbolEntry<Base>>(shList[i].offset, count);
+
+		/* lookup the string-table of the symbol-names */
+		const detail::SectionHeader<Base>& strings = shList[shList[i].link];
+		std::u8string_view names{ reader.base<char8_t>(strings.offset, strings.size), size_t(strings.size) };
+
+		for (size_t j = 0; j < count; ++j) {
+			if ((entries[j].info & detail::symbolType::mask) != detail::symbolType::function || entries[j].value == 0)
+				continue;
+			if (entries[j].sectionIndex == 0 || entries[j].sectionIndex >= header->shCount)
+				continue;
+			if (!detail::IsSet(shList[entries[j].sectionIndex].flags, detail::sectionFlags::instructions))
+				continue;
+
+			/* extract the null-terminated name of the symbol (empty if malformed) */
+			std::u8string_view name = (entries[j].name < names.size() ? names.substr(entries[j].name) : std::u8string_view{});
+			symbols.push_back(elf::Symbol{ std::u8string{ name.substr(0, name.find(u8'\0')) }, entries[j].value + baseAddress, entries[j].size });
+		}
 	}
 }
 
@@ -173,9 +234,25 @@ sys::detail::ElfConfig sys::detail::ValidateElfLoad(const detail::Reader& reader
 	return detail::ValidateElfLoadTyped<uint64_t>(reader);
 }
 
-void sys::detail::LoadElfProgHeaders(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader, uint8_t bitWidth) {
+void sys::detail::LoadElfProgHeaders(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader, const std::optional<elf::FileBacking>& backing, uint8_t bitWidth) {
 	if (bitWidth == 32)
-		detail::LoadElfProgHeadersTyped<uint32_t>(baseAddress, config, reader);
+		detail::LoadElfProgHeadersTyped<uint32_t>(baseAddress, config, reader, backing);
 	else
-		detail::LoadElfProgHeadersTyped<uint64_t>(baseAddress, config, reader);
+		detail::LoadElfProgHeadersTyped<uint64_t>(baseAddress, config, reader, backing);
+}
+void sys::detail::ReadElfSymbols(const detail::Reader& reader, env::guest_t baseAddress, std::vector<elf::Symbol>& symbols, uint8_t bitWidth) {
+	if (bitWidth == 32)
+		detail::ReadElfSymbolsTyped<uint32_t>(reader, baseAddress, symbols);
+	else
+		detail::ReadElfSymbolsTyped<uint64_t>(reader, baseAddress, symbols);
+}
+
+void sys::detail::ReadElfBacking(const elf::FileBacking& backing, uint64_t offset, uint8_t* data, uint64_t size) {
+	/* read the data from the file (must complete in-place, as the loading cannot be suspended) */
+	std::shared_ptr<std::optional<uint64_t>> read = std::make_shared<std::optional<uint64_t>>();
+	env::Instance()->filesystem().readFile(backing.id, offset, data, size, [read](std::optional<uint64_t> count) {
+		*read = count.value_or(0);
+		});
+	if (*read != size)
+		throw elf::Exception{ u8"Failed to read [", size, u8"] bytes from elf at [", offset, u8']' };
 }
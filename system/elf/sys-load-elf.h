@@ -24,14 +24,21 @@ namespace sys::detail {
 	detail::ElfConfig ValidateElfLoadTyped(const detail::Reader& reader);
 
 	template <class Base>
-	env::guest_t LoadElfSingleProgHeader(env::guest_t baseAddress, size_t index, const detail::ProgramHeader<Base>& header, const detail::Reader& reader);
+	env::guest_t LoadElfSingleProgHeader(env::guest_t baseAddress, size_t index, const detail::ProgramHeader<Base>& header, const detail::Reader& reader, const std::optional<elf::FileBacking>& backing);
 
 	template <class Base>
-	void LoadElfProgHeadersTyped(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader);
+	void LoadElfProgHeadersTyped(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader, const std::optional<elf::FileBacking>& backing);
+
+	template <class Base>
+	void ReadElfSymbolsTyped(const detail::Reader& reader, env::guest_t baseAddress, std::vector<elf::Symbol>& symbols);
 
 	uint8_t CheckElfSignature(const detail::Reader& reader);
 
 	detail::ElfConfig ValidateElfLoad(const detail::Reader& reader, uint8_t bitWidth);
 
-	void LoadElfProgHeaders(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader, uint8_t bitWidth);
+	void LoadElfProgHeaders(env::guest_t baseAddress, detail::ElfConfig& config, const detail::Reader& reader, const std::optional<elf::FileBacking>& backing, uint8_t bitWidth);
+
+	void ReadElfSymbols(const detail::Reader& reader, env::guest_t baseAddress, std::vector<elf::Symbol>& symbols, uint8_t bitWidth);
+
+	void ReadElfBacking(const elf::FileBacking& backing, uint64_t offset, uint8_t* data, uint64_t size);
 }
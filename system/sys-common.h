@@ -25,6 +25,7 @@
 
 namespace sys {
 	class Userspace;
+	class TranslateBench;
 	namespace detail {
 		class Syscall;
 
@@ -51,6 +52,8 @@ namespace sys {
 		};
 
 		struct AwaitingSyscall {};
+
+		struct ThreadSwitch {};
 	}
 
 	namespace errCode {
@@ -59,10 +62,14 @@ namespace sys {
 		static constexpr int64_t eNoEntry = -2;
 		static constexpr int64_t eInterrupted = -4;
 		static constexpr int64_t eIO = -5;
+		static constexpr int64_t eNoExec = -8;
 		static constexpr int64_t eBadFd = -9;
+		static constexpr int64_t eChild = -10;
+		static constexpr int64_t eAgain = -11;
 		static constexpr int64_t eNoMemory = -12;
 		static constexpr int64_t eAccess = -13;
 		static constexpr int64_t eFault = -14;
+		static constexpr int64_t eBusy = -16;
 		static constexpr int64_t eExists = -17;
 		static constexpr int64_t eNoDevice = -19;
 		static constexpr int64_t eNotDirectory = -20;
@@ -75,6 +82,7 @@ namespace sys {
 		static constexpr int64_t eNotImplemented = -38;
 		static constexpr int64_t eLoop = -40;
 		static constexpr int64_t eOpNotSupported = -95;
+		static constexpr int64_t eTimedOut = -110;
 		static constexpr int64_t eStale = -116;
 
 		/* custom error (not mapped to any linux errors) */
@@ -230,7 +238,14 @@ namespace sys {
 		prlimit64,
 		futex,
 		rt_sigprocmask,
-		getrandom
+		getrandom,
+		clone,
+		exit,
+		sched_yield,
+		checkpoint,
+		execve,
+		wait4,
+		getppid
 	};
 
 	struct SyscallArgs {
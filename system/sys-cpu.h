@@ -26,9 +26,16 @@ namespace sys {
 		/* add any potential wasm-related functions to the core-module */
 		virtual bool setupCore(wasm::Module& mod) = 0;
 
+		/* add any potential imports to the block-module (called before the translation of the block starts) */
+		virtual void setupBlock(wasm::Module& mod) = 0;
+
 		/* configure the context with the given starting-execution address and stack-pointer address */
 		virtual bool setupContext(env::guest_t pcAddress, env::guest_t spAddress) = 0;
 
+		/* configure the current context, which is a copy of the parent-context, for a newly cloned thread
+		*	(a null syscall-result must be written, and the tls-address only used if setTls is true) */
+		virtual void setupThread(env::guest_t spAddress, env::guest_t tlsAddress, bool setTls) = 0;
+
 	public:
 		/* fetch the arguments for a unix syscall
 		*	Note: will only be called within code produced by sys::Writer
@@ -0,0 +1,45 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include "../../system.h"
+
+static util::Logger logger{ u8"sys::syscall" };
+
+const sys::detail::DentryEntry* sys::detail::DentryCache::find(uint64_t parent, std::u8string_view name) const {
+	auto it = pEntries.find(DentryCache::Key{ parent, std::u8string{ name } });
+	return (it == pEntries.end() ? 0 : &it->second);
+}
+void sys::detail::DentryCache::insert(uint64_t parent, std::u8string_view name, const detail::DentryEntry& entry) {
+	/* check if the cache has become too large, in which case it is simply reset */
+	if (pEntries.size() >= detail::MaxDentryEntries) {
+		logger.debug(u8"Resetting dentry-cache after reaching [", pEntries.size(), u8"] entries");
+		clear();
+	}
+	DentryCache::Key key{ parent, std::u8string{ name } };
+	dropName(parent, name);
+
+	/* register the object to the name (objects reachable under multiple names only keep the last name cached) */
+	if (entry.exists) {
+		dropNode(entry.id);
+		pNodes[entry.id] = key;
+	}
+	pEntries[key] = entry;
+}
+void sys::detail::DentryCache::dropName(uint64_t parent, std::u8string_view name) {
+	auto it = pEntries.find(DentryCache::Key{ parent, std::u8string{ name } });
+	if (it == pEntries.end())
+		return;
+	if (it->second.exists)
+		pNodes.erase(it->second.id);
+	pEntries.erase(it);
+}
+void sys::detail::DentryCache::dropNode(uint64_t id) {
+	auto it = pNodes.find(id);
+	if (it == pNodes.end())
+		return;
+	pEntries.erase(it->second);
+	pNodes.erase(it);
+}
+void sys::detail::DentryCache::clear() {
+	pEntries.clear();
+	pNodes.clear();
+}
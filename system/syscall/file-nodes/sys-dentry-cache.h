@@ -0,0 +1,39 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "sys-node-base.h"
+
+namespace sys::detail {
+	static constexpr size_t MaxDentryEntries = 4096;
+
+	/* cached result of looking up a name in a native directory (stats, id, and type are only valid, if the object exists) */
+	struct DentryEntry {
+		detail::NodeStats stats;
+		uint64_t id = 0;
+		env::FileType type = env::FileType::_end;
+		bool exists = false;
+	};
+
+	/* cache of lookups of native file-objects by their parent-id and name, which also contains negative entries of
+	*	non-existing objects, in order to prevent repeated round-trips to the host (entries must be dropped by any
+	*	operation, which creates or writes to objects - access-times of cached objects might be stale) */
+	class DentryCache {
+	private:
+		using Key = std::pair<uint64_t, std::u8string>;
+
+	private:
+		std::map<DentryCache::Key, detail::DentryEntry> pEntries;
+		std::unordered_map<uint64_t, DentryCache::Key> pNodes;
+
+	public:
+		DentryCache() = default;
+
+	public:
+		const detail::DentryEntry* find(uint64_t parent, std::u8string_view name) const;
+		void insert(uint64_t parent, std::u8string_view name, const detail::DentryEntry& entry);
+		void dropName(uint64_t parent, std::u8string_view name);
+		void dropNode(uint64_t id);
+		void clear();
+	};
+}
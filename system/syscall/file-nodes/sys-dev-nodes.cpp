@@ -11,6 +11,9 @@ int64_t sys::detail::impl::Terminal::open(bool tryRead, bool tryWrite, bool trun
 int64_t sys::detail::impl::Terminal::read(uint64_t offset, std::vector<uint8_t>& buffer, std::function<int64_t(int64_t)> callback) {
 	/* ignore any offset - as this is a character-device */
 
+	/* flush any pending output (such as prompts) before blocking on the input */
+	host::FlushOut();
+
 	/* read the data from the input and write them out to the guest buffer */
 	env::Instance()->readInput(buffer.size(), [this, callback, &buffer](std::u8string_view read) {
 		pSyscall->callContinue([read, callback, &buffer]() -> int64_t {
@@ -21,8 +24,8 @@ int64_t sys::detail::impl::Terminal::read(uint64_t offset, std::vector<uint8_t>&
 	return pSyscall->callIncomplete();
 }
 int64_t sys::detail::impl::Terminal::write(uint64_t offset, const std::vector<uint8_t>& buffer, std::function<int64_t(int64_t)> callback) {
-	/* ignore any offset - as this is a character-device */
-	host::PrintOut({ reinterpret_cast<const char8_t*>(buffer.data()), buffer.size() });
+	/* ignore any offset - as this is a character-device (output is buffered and flushed in bulk) */
+	host::BufferOut({ reinterpret_cast<const char8_t*>(buffer.data()), buffer.size() });
 	return callback(buffer.size());
 }
 
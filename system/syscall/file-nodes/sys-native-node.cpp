@@ -17,15 +17,26 @@ sys::detail::NodeStats sys::detail::impl::NativeFileNode::fMakeNodeStats(const e
 }
 
 int64_t sys::detail::impl::NativeFileNode::makeLookup(std::u8string_view name, std::function<int64_t(const detail::SharedNode&, const detail::NodeStats&)> callback) const {
+	/* check if the lookup has already been resolved (including non-existing objects) */
+	if (const detail::DentryEntry* entry = pSyscall->files().dentries().find(pFileId, name); entry != 0) {
+		if (!entry->exists)
+			return callback({}, {});
+		return callback(std::make_shared<impl::NativeFileNode>(entry->type, pSyscall, entry->id), entry->stats);
+	}
+
 	/* query the stats of the target name */
-	env::Instance()->filesystem().readStats(pFileId, name, [this, callback](const env::FileStats* stats) {
-		pSyscall->callContinue([this, callback, stats]() -> int64_t {
-			/* check if the object exists */
-			if (stats == 0)
+	env::Instance()->filesystem().readStats(pFileId, name, [this, callback, _name = std::u8string{ name }](const env::FileStats* stats) {
+		pSyscall->callContinue([this, callback, _name, stats]() -> int64_t {
+			/* check if the object exists and cache the result */
+			if (stats == 0) {
+				pSyscall->files().dentries().insert(pFileId, _name, detail::DentryEntry{});
 				return callback({}, {});
+			}
+			detail::DentryEntry entry{ .stats = fMakeNodeStats(*stats), .id = stats->id, .type = stats->type, .exists = true };
+			pSyscall->files().dentries().insert(pFileId, _name, entry);
 
 			/* spawn the native node */
-			return callback(std::make_shared<impl::NativeFileNode>(stats->type, pSyscall, stats->id), fMakeNodeStats(*stats));
+			return callback(std::make_shared<impl::NativeFileNode>(stats->type, pSyscall, stats->id), entry.stats);
 			});
 		});
 
@@ -33,6 +44,10 @@ int64_t sys::detail::impl::NativeFileNode::makeLookup(std::u8string_view name, s
 	return pSyscall->callIncomplete();
 }
 int64_t sys::detail::impl::NativeFileNode::makeCreate(std::u8string_view name, env::FileAccess access, std::function<int64_t(int64_t, const detail::SharedNode&)> callback) {
+	/* drop the cached non-existance of the object and the stats of this directory */
+	pSyscall->files().dentries().dropName(pFileId, name);
+	pSyscall->files().dentries().dropNode(pFileId);
+
 	/* try to create the file-object */
 	env::Instance()->filesystem().createFile(pFileId, name, access, [this, callback](std::optional<uint64_t> fileId) {
 		pSyscall->callContinue([this, callback, fileId]() -> int64_t {
@@ -51,12 +66,18 @@ int64_t sys::detail::impl::NativeFileNode::makeCreate(std::u8string_view name, e
 int64_t sys::detail::impl::NativeFileNode::makeListDir(std::function<int64_t(int64_t, const std::vector<detail::DirEntry>&)> callback) {
 	/* perform the read-operation */
 	env::Instance()->filesystem().readDirectory(pFileId, [this, callback](const std::map<std::u8string, env::FileStats>* map) {
-		pSyscall->callContinue([callback, map]() -> int64_t {
+		pSyscall->callContinue([this, callback, map]() -> int64_t {
 			if (map == 0)
 				return callback(errCode::eIO, {});
+
+			/* populate the dentry-cache with the received stats, as the children are likely to be looked up next (unless they would flood the cache) */
+			bool populate = (map->size() <= detail::MaxDentryEntries / 4);
 			std::vector<detail::DirEntry> out;
-			for (const auto& [key, value] : *map)
+			for (const auto& [key, value] : *map) {
 				out.emplace_back(detail::DirEntry{ .name = key, .id = value.id, .type = value.type });
+				if (populate)
+					pSyscall->files().dentries().insert(pFileId, key, detail::DentryEntry{ .stats = fMakeNodeStats(value), .id = value.id, .type = value.type, .exists = true });
+			}
 			return callback(errCode::eSuccess, out);
 			});
 		});
@@ -89,6 +110,8 @@ int64_t sys::detail::impl::NativeFileNode::flagRead(std::function<int64_t()> cal
 	return pSyscall->callIncomplete();
 }
 int64_t sys::detail::impl::NativeFileNode::flagWritten(std::function<int64_t()> callback) {
+	pSyscall->files().dentries().dropNode(pFileId);
+
 	/* perform the access-operation */
 	env::Instance()->filesystem().changedObject(pFileId, [this, callback](bool success) {
 		pSyscall->callContinue([callback]() -> int64_t { return callback(); });
@@ -100,6 +123,7 @@ int64_t sys::detail::impl::NativeFileNode::flagWritten(std::function<int64_t()>
 int64_t sys::detail::impl::NativeFileNode::open(bool tryRead, bool tryWrite, bool truncate, std::function<int64_t(int64_t)> callback) {
 	/* check if the file should be truncated */
 	if (truncate) {
+		pSyscall->files().dentries().dropNode(pFileId);
 		env::Instance()->filesystem().resizeFile(pFileId, 0, [this, callback](bool success) {
 			pSyscall->callContinue([this, callback, success]() -> int64_t {
 				return callback(success ? errCode::eSuccess : errCode::eInterrupted);
@@ -132,6 +156,8 @@ int64_t sys::detail::impl::NativeFileNode::read(uint64_t offset, std::vector<uin
 	return pSyscall->callIncomplete();
 }
 int64_t sys::detail::impl::NativeFileNode::write(uint64_t offset, const std::vector<uint8_t>& buffer, std::function<int64_t(int64_t)> callback) {
+	pSyscall->files().dentries().dropNode(pFileId);
+
 	/* perform the write-operation */
 	env::Instance()->filesystem().writeFile(pFileId, offset, buffer.data(), buffer.size(), [this, callback](std::optional<uint64_t> count) {
 		pSyscall->callContinue([callback, count]() -> int64_t {
@@ -144,3 +170,34 @@ int64_t sys::detail::impl::NativeFileNode::write(uint64_t offset, const std::vec
 	/* potentially defer the call */
 	return pSyscall->callIncomplete();
 }
+bool sys::detail::impl::NativeFileNode::supportsDirect() const {
+	return true;
+}
+int64_t sys::detail::impl::NativeFileNode::readDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback) {
+	/* perform the read-operation straight into the guest memory */
+	env::Instance()->filesystem().readFileDirect(pFileId, offset, ranges, [this, callback](std::optional<uint64_t> count) {
+		pSyscall->callContinue([callback, count]() -> int64_t {
+			if (!count.has_value())
+				return callback(errCode::eIO);
+			return callback(count.value());
+			});
+		});
+
+	/* potentially defer the call */
+	return pSyscall->callIncomplete();
+}
+int64_t sys::detail::impl::NativeFileNode::writeDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback) {
+	pSyscall->files().dentries().dropNode(pFileId);
+
+	/* perform the write-operation straight out of the guest memory */
+	env::Instance()->filesystem().writeFileDirect(pFileId, offset, ranges, [this, callback](std::optional<uint64_t> count) {
+		pSyscall->callContinue([callback, count]() -> int64_t {
+			if (!count.has_value())
+				return callback(errCode::eIO);
+			return callback(count.value());
+			});
+		});
+
+	/* potentially defer the call */
+	return pSyscall->callIncomplete();
+}
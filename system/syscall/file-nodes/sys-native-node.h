@@ -5,6 +5,7 @@
 #include "sys-node-base.h"
 #include "sys-dev-nodes.h"
 #include "sys-proc-nodes.h"
+#include "sys-dentry-cache.h"
 
 namespace sys::detail::impl {
 	/* file-node, which provides access to actual native file-objects */
@@ -31,5 +32,8 @@ namespace sys::detail::impl {
 		int64_t open(bool tryRead, bool tryWrite, bool truncate, std::function<int64_t(int64_t)> callback) final;
 		int64_t read(uint64_t offset, std::vector<uint8_t>& buffer, std::function<int64_t(int64_t)> callback) final;
 		int64_t write(uint64_t offset, const std::vector<uint8_t>& buffer, std::function<int64_t(int64_t)> callback) final;
+		bool supportsDirect() const final;
+		int64_t readDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback) final;
+		int64_t writeDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback) final;
 	};
 }
@@ -195,6 +195,15 @@ int64_t sys::detail::FileNode::write(uint64_t offset, const std::vector<uint8_t>
 int64_t sys::detail::FileNode::close(std::function<int64_t()> callback) {
 	return callback();
 }
+bool sys::detail::FileNode::supportsDirect() const {
+	return false;
+}
+int64_t sys::detail::FileNode::readDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback) {
+	return callback(errCode::eIO);
+}
+int64_t sys::detail::FileNode::writeDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback) {
+	return callback(errCode::eIO);
+}
 
 
 sys::detail::RealFileNode::RealFileNode(uint64_t id, env::FileType type) : FileNode{ id, false, type } {}
@@ -86,6 +86,12 @@ namespace sys::detail {
 		virtual int64_t read(uint64_t offset, std::vector<uint8_t>& buffer, std::function<int64_t(int64_t)> callback);
 		virtual int64_t write(uint64_t offset, const std::vector<uint8_t>& buffer, std::function<int64_t(int64_t)> callback);
 		virtual int64_t close(std::function<int64_t()> callback);
+
+	public:
+		/* file-interactions, which transfer the data directly from/to the physical guest memory (only used if supported) */
+		virtual bool supportsDirect() const;
+		virtual int64_t readDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback);
+		virtual int64_t writeDirect(uint64_t offset, const std::vector<env::PhysicalRange>& ranges, std::function<int64_t(int64_t)> callback);
 	};
 
 	/* real file-node */
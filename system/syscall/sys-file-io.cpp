@@ -229,6 +229,17 @@ int64_t sys::detail::FileIO::fSetupFile(const detail::SharedNode& node, const Fi
 	++pOpened;
 	return index;
 }
+void sys::detail::FileIO::fReleaseFd(int64_t fd) {
+	/* remove the reference to the node */
+	if (--fInstance(fd).user == 0) {
+		fInstance(fd).dirCache.clear();
+		fInstance(fd).node.reset();
+	}
+
+	/* release the open-entry and update the open-counter */
+	pOpen[fd].used = false;
+	--pOpened;
+}
 sys::linux::FileStats sys::detail::FileIO::fBuildLinuxStats(const detail::SharedNode& node, const detail::NodeStats& stats) const {
 	linux::FileStats out;
 	uint64_t ctime = std::max<uint64_t>(stats.timeAccessedUS, stats.timeModifiedUS);
@@ -279,15 +290,27 @@ sys::linux::FileStats sys::detail::FileIO::fBuildLinuxStats(const detail::Shared
 	}
 	return out;
 }
-int64_t sys::detail::FileIO::fRead(uint64_t fd, std::optional<uint64_t> offset, std::function<int64_t(int64_t)> callback) {
+bool sys::detail::FileIO::fResolveDirect(env::guest_t address, uint64_t size) {
+	/* resolve the range to be read into (the read may return less data than requested, in which case
+	*	an only partially mapped range is not a fault, and the caller falls back to copying the data) */
+	try {
+		env::Instance()->memory().mresolve(pRanges, address, size, env::Usage::Write);
+	}
+	catch (const env::MemoryFault&) {
+		pRanges.clear();
+		return false;
+	}
+	return true;
+}
+int64_t sys::detail::FileIO::fRead(uint64_t fd, std::optional<uint64_t> offset, bool direct, std::function<int64_t(int64_t)> callback) {
 	FileIO::Instance& instance = fInstance(fd);
 
 	/* fetch the offset to be used */
 	bool fileOffset = (!offset.has_value() && instance.node->type() == env::FileType::file);
 	uint64_t _offset = (fileOffset ? instance.offset : offset.value_or(0));
 
-	/* perform the actual read of the data */
-	return instance.node->read(_offset, pBuffer, [&instance, fileOffset, callback](int64_t result) -> int64_t {
+	/* setup the completion of the read */
+	std::function<int64_t(int64_t)> completed = [&instance, fileOffset, callback](int64_t result) -> int64_t {
 		if (result < 0)
 			return callback(result);
 		if (fileOffset)
@@ -295,19 +318,24 @@ int64_t sys::detail::FileIO::fRead(uint64_t fd, std::optional<uint64_t> offset,
 
 		/* mark the node as read */
 		return instance.node->flagRead([result, callback]() -> int64_t { return callback(result); });
-		});
+		};
+
+	/* perform the actual read of the data (either into the buffer or directly into the resolved guest memory) */
+	if (direct)
+		return instance.node->readDirect(_offset, pRanges, completed);
+	return instance.node->read(_offset, pBuffer, completed);
 }
-int64_t sys::detail::FileIO::fWrite(uint64_t fd, std::optional<uint64_t> offset) {
+int64_t sys::detail::FileIO::fWrite(uint64_t fd, std::optional<uint64_t> offset, bool direct) {
 	FileIO::Instance& instance = fInstance(fd);
 
 	/* setup the final write-function to be used */
-	std::function<int64_t()> callback = [this, &instance, offset]() -> int64_t {
+	std::function<int64_t()> callback = [this, &instance, offset, direct]() -> int64_t {
 		/* fetch the offset to be used */
 		bool fileOffset = (!offset.has_value() && instance.node->type() == env::FileType::file);
 		uint64_t _offset = (fileOffset ? instance.offset : offset.value_or(0));
 
-		/* perform the actual write of the data */
-		return instance.node->write(_offset, pBuffer, [&instance, fileOffset](int64_t result) -> int64_t {
+		/* setup the completion of the write */
+		std::function<int64_t(int64_t)> completed = [&instance, fileOffset](int64_t result) -> int64_t {
 			if (result < 0)
 				return result;
 			if (fileOffset)
@@ -315,7 +343,12 @@ int64_t sys::detail::FileIO::fWrite(uint64_t fd, std::optional<uint64_t> offset)
 
 			/* mark the node as written */
 			return instance.node->flagWritten([result]() -> int64_t { return result; });
-			});
+			};
+
+		/* perform the actual write of the data (either out of the buffer or directly out of the resolved guest memory) */
+		if (direct)
+			return instance.node->writeDirect(_offset, pRanges, completed);
+		return instance.node->write(_offset, pBuffer, completed);
 		};
 
 	/* check if the write can just be executed or if the file-end needs to be fetched */
@@ -579,15 +612,7 @@ int64_t sys::detail::FileIO::close(int64_t fd) {
 
 	/* close the underlying file object */
 	return fInstance(fd).node->close([this, fd]() -> int64_t {
-		/* remove the reference to the node */
-		if (--fInstance(fd).user == 0) {
-			fInstance(fd).dirCache.clear();
-			fInstance(fd).node.reset();
-		}
-
-		/* release the open-entry and update the open-counter */
-		pOpen[fd].used = false;
-		--pOpened;
+		fReleaseFd(fd);
 		return errCode::eSuccess;
 		});
 }
@@ -597,9 +622,14 @@ int64_t sys::detail::FileIO::read(int64_t fd, env::guest_t address, uint64_t siz
 	if (res != 0 || size == 0)
 		return res;
 
+	/* check if the data can be read directly into the guest memory */
+	pRanges.clear();
+	if (fInstance(fd).node->supportsDirect() && fResolveDirect(address, size))
+		return fRead(fd, std::nullopt, true, [](int64_t read) -> int64_t { return read; });
+
 	/* fetch the data to be read */
 	pBuffer.resize(size);
-	return fRead(fd, std::nullopt, [this, address](int64_t read) -> int64_t {
+	return fRead(fd, std::nullopt, false, [this, address](int64_t read) -> int64_t {
 		if (read <= 0)
 			return read;
 
@@ -616,6 +646,21 @@ int64_t sys::detail::FileIO::readv(int64_t fd, env::guest_t vec, uint64_t count)
 	pCached.clear();
 	pBuffer.clear();
 
+	/* check if the data can be scattered directly into the guest memory, in which case only the ranges need to be collected */
+	pRanges.clear();
+	if (fInstance(fd).node->supportsDirect()) {
+		bool resolved = true;
+		for (size_t i = 0; i < count && resolved; ++i) {
+			env::guest_t address = env::Instance()->memory().read<env::guest_t>(vec + (i * 2 + 0) * sizeof(env::guest_t));
+			uint64_t size = env::Instance()->memory().read<env::guest_t>(vec + (i * 2 + 1) * sizeof(env::guest_t));
+			resolved = fResolveDirect(address, size);
+		}
+		if (resolved && pRanges.empty())
+			return 0;
+		if (resolved)
+			return fRead(fd, std::nullopt, true, [](int64_t read) -> int64_t { return read; });
+	}
+
 	/* collect the total readable size */
 	for (size_t i = 0; i < count; ++i) {
 		env::guest_t address = env::Instance()->memory().read<env::guest_t>(vec + (i * 2 + 0) * sizeof(env::guest_t));
@@ -628,7 +673,7 @@ int64_t sys::detail::FileIO::readv(int64_t fd, env::guest_t vec, uint64_t count)
 	}
 
 	/* fetch the data to be read */
-	return fRead(fd, std::nullopt, [this](int64_t read) -> int64_t {
+	return fRead(fd, std::nullopt, false, [this](int64_t read) -> int64_t {
 		if (read <= 0)
 			return read;
 
@@ -652,12 +697,19 @@ int64_t sys::detail::FileIO::write(int64_t fd, env::guest_t address, uint64_t si
 	if (res != 0 || size == 0)
 		return res;
 
+	/* check if the data can be written directly out of the guest memory */
+	if (fInstance(fd).node->supportsDirect()) {
+		pRanges.clear();
+		env::Instance()->memory().mresolve(pRanges, address, size, env::Usage::Read);
+		return fWrite(fd, std::nullopt, true);
+	}
+
 	/* read the data from the guest */
 	pBuffer.resize(size);
 	env::Instance()->memory().mread(pBuffer.data(), address, size, env::Usage::Read);
 
 	/* write the data out */
-	return fWrite(fd, std::nullopt);
+	return fWrite(fd, std::nullopt, false);
 }
 int64_t sys::detail::FileIO::writev(int64_t fd, env::guest_t vec, uint64_t count) {
 	/* validate the fd and access */
@@ -665,15 +717,21 @@ int64_t sys::detail::FileIO::writev(int64_t fd, env::guest_t vec, uint64_t count
 	if (res != 0 || count == 0)
 		return res;
 	pBuffer.clear();
+	pRanges.clear();
 	size_t total = 0;
+	bool direct = fInstance(fd).node->supportsDirect();
 
-	/* read the data from the guest */
+	/* read the data from the guest (or only collect the ranges, if they can be gathered directly out of the guest memory) */
 	for (size_t i = 0; i < count; ++i) {
 		/* read the next vector to be written out */
 		env::guest_t address = env::Instance()->memory().read<env::guest_t>(vec + (i * 2 + 0) * sizeof(env::guest_t));
 		uint64_t size = env::Instance()->memory().read<env::guest_t>(vec + (i * 2 + 1) * sizeof(env::guest_t));
 		if (size == 0)
 			continue;
+		if (direct) {
+			env::Instance()->memory().mresolve(pRanges, address, size, env::Usage::Read);
+			continue;
+		}
 
 		/* collect the data and append them to the buffer */
 		pBuffer.insert(pBuffer.end(), size, 0);
@@ -682,7 +740,9 @@ int64_t sys::detail::FileIO::writev(int64_t fd, env::guest_t vec, uint64_t count
 	}
 
 	/* write the data out */
-	return fWrite(fd, std::nullopt);
+	if (direct && pRanges.empty())
+		return 0;
+	return fWrite(fd, std::nullopt, direct);
 }
 int64_t sys::detail::FileIO::readlinkat(int64_t dirfd, std::u8string_view path, env::guest_t address, uint64_t size) {
 	return fReadLinkAt(dirfd, path, address, size);
@@ -968,8 +1028,47 @@ sys::detail::FdState sys::detail::FileIO::fdCheck(int64_t fd) const {
 	state.modify = fInstance(fd).config.modify;
 	state.append = fInstance(fd).config.append;
 	state.type = fInstance(fd).node->type();
+	state.direct = fInstance(fd).node->supportsDirect();
 	return state;
 }
+sys::detail::FileIO::Table sys::detail::FileIO::fdFork() {
+	/* the suspended parent keeps referencing the same instances (offsets are therefore shared with the child) */
+	for (const FileIO::Open& open : pOpen) {
+		if (open.used)
+			++pInstance[open.instance].user;
+	}
+	return FileIO::Table{ pOpen, pOpened };
+}
+void sys::detail::FileIO::fdRestore(FileIO::Table&& table) {
+	/* release all descriptors of the current process (closing the nodes themselves has no side-effects) */
+	for (size_t fd = 0; fd < pOpen.size(); ++fd) {
+		if (pOpen[fd].used)
+			fReleaseFd(fd);
+	}
+
+	/* reinstate the table of the suspended process */
+	pOpen = std::move(table.open);
+	pOpened = table.opened;
+}
+void sys::detail::FileIO::fdExecute() {
+	/* release all descriptors marked as close-on-execute */
+	for (size_t fd = 0; fd < pOpen.size(); ++fd) {
+		if (pOpen[fd].used && pOpen[fd].closeOnExecute)
+			fReleaseFd(fd);
+	}
+}
+bool sys::detail::FileIO::fdOnlyStandard() const {
+	if (pOpened != 3)
+		return false;
+
+	/* check if the open descriptors are the initial terminal descriptors (stdin/stdout/stderr) */
+	for (int64_t fd = 0; fd < 3; ++fd) {
+		detail::FdState state = fdCheck(fd);
+		if (!state.valid || state.type != env::FileType::terminal || state.read != (fd == 0) || state.write != (fd != 0))
+			return false;
+	}
+	return true;
+}
 int64_t sys::detail::FileIO::fdStats(int64_t fd, std::function<int64_t(int64_t, const env::FileStats&)> callback) const {
 	if (!fCheckFd(fd))
 		return callback(errCode::eBadFd, {});
@@ -1000,9 +1099,12 @@ int64_t sys::detail::FileIO::fdRead(int64_t fd, uint64_t offset, uint64_t size,
 
 	/* fetch the data to be read */
 	pBuffer.resize(size);
-	return fRead(pOpen[fd].instance, offset, [this, callback](int64_t read) -> int64_t {
+	return fRead(pOpen[fd].instance, offset, false, [this, callback](int64_t read) -> int64_t {
 		if (read <= 0)
 			return callback(0, 0);
 		return callback(pBuffer.data(), read);
 		});
 }
+sys::detail::DentryCache& sys::detail::FileIO::dentries() {
+	return pDentries;
+}
@@ -71,6 +71,7 @@ namespace sys::detail {
 		bool write = false;
 		bool modify = false;
 		bool append = false;
+		bool direct = false;
 		env::FileType type = env::FileType::_end;
 	};
 
@@ -103,12 +104,21 @@ namespace sys::detail {
 			bool closeOnExecute = false;
 		};
 
+	public:
+		/* file-descriptor table of a suspended process, which holds its own references to the instances */
+		struct Table {
+			std::vector<FileIO::Open> open;
+			size_t opened = 0;
+		};
+
 	private:
 		std::shared_ptr<impl::RootFileNode> pRoot;
 		std::vector<Instance> pInstance;
 		std::vector<Open> pOpen;
 		std::vector<uint8_t> pBuffer;
 		std::vector<uint64_t> pCached;
+		std::vector<env::PhysicalRange> pRanges;
+		detail::DentryCache pDentries;
 		detail::Syscall* pSyscall = 0;
 		size_t pOpened = 0;
 		struct {
@@ -139,10 +149,12 @@ namespace sys::detail {
 
 	private:
 		int64_t fLookupNextFd(uint64_t start, bool canFail);
+		void fReleaseFd(int64_t fd);
 		int64_t fSetupFile(const detail::SharedNode& node, const FileIO::InstanceConfig& config, bool closeOnExecute);
 		linux::FileStats fBuildLinuxStats(const detail::SharedNode& node, const detail::NodeStats& stats) const;
-		int64_t fRead(uint64_t fd, std::optional<uint64_t> offset, std::function<int64_t(int64_t)> callback);
-		int64_t fWrite(uint64_t fd, std::optional<uint64_t> offset);
+		bool fResolveDirect(env::guest_t address, uint64_t size);
+		int64_t fRead(uint64_t fd, std::optional<uint64_t> offset, bool direct, std::function<int64_t(int64_t)> callback);
+		int64_t fWrite(uint64_t fd, std::optional<uint64_t> offset, bool direct);
 
 	private:
 		int64_t fOpenAt(int64_t dirfd, std::u8string_view path, uint64_t flags, uint64_t mode);
@@ -175,7 +187,12 @@ namespace sys::detail {
 
 	public:
 		detail::FdState fdCheck(int64_t fd) const;
+		bool fdOnlyStandard() const;
+		FileIO::Table fdFork();
+		void fdRestore(FileIO::Table&& table);
+		void fdExecute();
 		int64_t fdStats(int64_t fd, std::function<int64_t(int64_t, const env::FileStats&)> callback) const;
 		int64_t fdRead(int64_t fd, uint64_t offset, uint64_t size, std::function<int64_t(const uint8_t*, uint64_t)> callback);
+		detail::DentryCache& dentries();
 	};
 }
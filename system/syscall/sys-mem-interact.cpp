@@ -29,6 +29,7 @@ bool sys::detail::MemoryInteract::fCheckRange(env::guest_t address, uint64_t len
 		/* patch the range to unmap all of the memory, which overlaps with the source paramter */
 		uint64_t tBegin = std::max<uint64_t>(range.first, address);
 		uint64_t tSize = std::min<uint64_t>(range.first + range.second, end) - tBegin;
+		fDropMappings(tBegin, tSize, false);
 		if (!env::Instance()->memory().munmap(tBegin, tSize))
 			logger.fatal(u8"Failed to unmap existing range [", str::As{ U"#018x", tBegin }, u8"] - [", str::As{ U"#018x", tBegin + tSize - 1 }, u8']');
 
@@ -38,10 +39,13 @@ bool sys::detail::MemoryInteract::fCheckRange(env::guest_t address, uint64_t len
 	}
 	return true;
 }
-int64_t sys::detail::MemoryInteract::fMapRange(env::guest_t address, uint64_t length, uint32_t usage, uint32_t flags) {
-	/* check if a any address can be picked */
+int64_t sys::detail::MemoryInteract::fMapRange(env::guest_t address, uint64_t length, uint32_t usage, uint32_t flags, std::optional<env::guest_t> source) {
+	/* check if a any address can be picked (either for a new allocation or for sharing the source) */
 	if (!detail::IsSet(flags, consts::mmFlagFixed) && !detail::IsSet(flags, consts::mmFlagFixedNoReplace)) {
-		address = env::Instance()->memory().alloc(length, usage);
+		if (source.has_value())
+			address = env::Instance()->memory().allocShared(*source, length);
+		else
+			address = env::Instance()->memory().alloc(length, usage);
 		if (address == 0)
 			return errCode::eNoMemory;
 	}
@@ -54,11 +58,53 @@ int64_t sys::detail::MemoryInteract::fMapRange(env::guest_t address, uint64_t le
 	else if (!fCheckRange(address, length, !detail::IsSet(flags, consts::mmFlagFixedNoReplace)))
 		return errCode::eExists;
 
+	/* share the source into the range */
+	else if (source.has_value()) {
+		if (!env::Instance()->memory().mshare(address, *source, length))
+			return errCode::eNoMemory;
+	}
+
 	/* allocate the requested range */
 	else if (!env::Instance()->memory().mmap(address, length, usage))
 		return errCode::eNoMemory;
 	return address;
 }
+void sys::detail::MemoryInteract::fUnshare(env::guest_t address, uint64_t length) {
+	env::Memory& mem = env::Instance()->memory();
+
+	/* fetch the content and the usages of the range (reading will populate any lazy chunks) */
+	std::vector<uint8_t> buffer(length);
+	mem.mread(buffer.data(), address, length, env::Usage::None);
+	std::vector<std::pair<env::guest_t, uint32_t>> usages;
+	for (env::guest_t page = address; page < address + length; page += pPageSize) {
+		uint32_t usage = mem.getUsage(page);
+		if (usages.empty() || usages.back().second != usage)
+			usages.push_back({ page, usage });
+	}
+
+	/* remap the range onto its own physical memory and write the content and usages back */
+	if (!mem.munmap(address, length) || !mem.mmap(address, length, env::Usage::ReadWrite))
+		logger.fatal(u8"Failed to relocate shared range [", str::As{ U"#018x", address }, u8"] - [", str::As{ U"#018x", address + length - 1 }, u8']');
+	mem.mwrite(address, buffer.data(), length, env::Usage::None);
+	for (size_t i = 0; i < usages.size(); ++i) {
+		env::guest_t end = (i + 1 < usages.size() ? usages[i + 1].first : address + length);
+		if (!mem.mprotect(usages[i].first, end - usages[i].first, usages[i].second))
+			logger.fatal(u8"Failed to restore usage of relocated range [", str::As{ U"#018x", usages[i].first }, u8']');
+	}
+}
+void sys::detail::MemoryInteract::fDropMappings(env::guest_t address, uint64_t length, bool unshare) {
+	/* lookup the first file-mapping, which overlaps the range */
+	auto it = pMappings.upper_bound(address);
+	if (it != pMappings.begin() && std::prev(it)->first + std::prev(it)->second.size > address)
+		--it;
+
+	/* remove all overlapping file-mappings (and relocate them out of any shared physical memory, if they are about to be modified) */
+	while (it != pMappings.end() && it->first < address + length) {
+		if (unshare && env::Instance()->memory().totalShared() > 0)
+			fUnshare(it->first, it->second.size);
+		it = pMappings.erase(it);
+	}
+}
 
 bool sys::detail::MemoryInteract::setup(detail::Syscall* syscall, env::guest_t endOfData) {
 	pSyscall = syscall;
@@ -74,6 +120,17 @@ bool sys::detail::MemoryInteract::setup(detail::Syscall* syscall, env::guest_t e
 	}
 	return true;
 }
+const sys::detail::BreakState& sys::detail::MemoryInteract::breakState() const {
+	return pBrk;
+}
+void sys::detail::MemoryInteract::restoreBreak(const detail::BreakState& state) {
+	/* the break-memory itself is restored as part of the memory-regions */
+	pBrk = state;
+}
+void sys::detail::MemoryInteract::resetMappings() {
+	/* the memory has been replaced entirely, therefore no file-mappings can be shared anymore */
+	pMappings.clear();
+}
 int64_t sys::detail::MemoryInteract::brk(env::guest_t address) {
 	/* check if the address lies beneath the initial address, in which case
 	*	the current break can just be returned, as no changes will be made */
@@ -85,6 +142,7 @@ int64_t sys::detail::MemoryInteract::brk(env::guest_t address) {
 
 	/* check if memory can be released (ignore failure of unmapping the memory) */
 	if (aligned < pBrk.aligned) {
+		fDropMappings(aligned, pBrk.aligned - aligned, false);
 		if (!env::Instance()->memory().munmap(aligned, pBrk.aligned - aligned))
 			logger.warn(u8"Unable to release break-memory");
 		else
@@ -146,7 +204,7 @@ int64_t sys::detail::MemoryInteract::mmap(env::guest_t address, uint64_t length,
 			return errCode::eInvalid;
 
 		/* map the range and check if an error occurred */
-		int64_t result = fMapRange(address, alignedLength, usage, flags);
+		int64_t result = fMapRange(address, alignedLength, usage, flags, std::nullopt);
 		if (result < 0)
 			return result;
 		return result;
@@ -169,8 +227,12 @@ int64_t sys::detail::MemoryInteract::mmap(env::guest_t address, uint64_t length,
 		return errCode::eNoDevice;
 	}
 
+	/* check if the file can be populated lazily upon access, which requires the data to be readable
+	*	in-place directly into the guest memory, and no writes to be made to the private copy */
+	bool lazy = (state.direct && !detail::IsSet(protect, consts::mmProtWrite) && env::Instance()->filesystem().completesInplace());
+
 	/* fetch the file-states */
-	return pSyscall->files().fdStats(fd, [this, fd, offset, length, flags, address, alignedLength, usage](int64_t result, const env::FileStats& stats) -> int64_t {
+	return pSyscall->files().fdStats(fd, [this, fd, offset, length, flags, address, alignedLength, usage, lazy](int64_t result, const env::FileStats& stats) -> int64_t {
 		/* check if an error occurred */
 		if (result != errCode::eSuccess)
 			return result;
@@ -182,11 +244,37 @@ int64_t sys::detail::MemoryInteract::mmap(env::guest_t address, uint64_t length,
 		else if (offset + length >= stats.size)
 			actual = stats.size - offset;
 
+		/* check if an identical file-mapping exists, which can be shared (lookup first, as mapping the range might replace it) */
+		detail::FileMapping mapping{ alignedLength, stats.id, offset, stats.size, stats.timeModifiedUS, usage };
+		std::optional<env::guest_t> source;
+		if (lazy) {
+			for (const auto& [start, existing] : pMappings) {
+				if (existing.size == mapping.size && existing.id == mapping.id && existing.offset == mapping.offset && existing.fileSize == mapping.fileSize
+					&& existing.modifiedUS == mapping.modifiedUS && existing.usage == mapping.usage && (start >= address + alignedLength || start + existing.size <= address)) {
+					source = start;
+					break;
+				}
+			}
+		}
+
 		/* map the range and check if an error occurred */
-		int64_t allocated = fMapRange(address, alignedLength, usage, flags);
+		int64_t allocated = fMapRange(address, alignedLength, usage, flags, source);
 		if (allocated < 0)
 			return allocated;
 
+		/* check if the file is populated lazily, in which case only the remainder needs to be locked (already done for shared ranges) */
+		if (lazy) {
+			uint64_t alignedSize = fPageAlignUp(actual);
+			if (!source.has_value()) {
+				if (alignedSize > 0)
+					env::Instance()->memory().mlazy(allocated, alignedSize, stats.id, offset);
+				if (alignedSize < alignedLength && !env::Instance()->memory().mprotect(allocated + alignedSize, alignedLength - alignedSize, env::Usage::Lock))
+					logger.fatal(u8"Unexpected error while locking remainder of allocated range for mmap");
+			}
+			pMappings[allocated] = mapping;
+			return allocated;
+		}
+
 		/* read the file and write the data to the range */
 		return pSyscall->files().fdRead(fd, offset, actual, [this, allocated, alignedLength](const uint8_t* ptr, uint64_t size) -> int64_t {
 			/* write the received data to the guest */
@@ -226,6 +314,9 @@ int64_t sys::detail::MemoryInteract::mprotect(env::guest_t address, uint64_t len
 	if (detail::IsSet(protect, consts::mmProtExec))
 		usage |= env::Usage::Execute;
 
+	/* release the affected file-mappings (and ensure writes cannot affect other shared mappings) */
+	fDropMappings(address, fPageAlignUp(length), detail::IsSet(usage, env::Usage::Write));
+
 	/* perform the memory operation */
 	if (!env::Instance()->memory().mprotect(address, fPageAlignUp(length), usage))
 		return errCode::eNoMemory;
@@ -241,6 +332,7 @@ int64_t sys::detail::MemoryInteract::munmap(env::guest_t address, uint64_t lengt
 		return errCode::eInvalid;
 
 	/* perform the memory operation */
+	fDropMappings(address, fPageAlignUp(length), false);
 	if (!env::Instance()->memory().munmap(address, fPageAlignUp(length)))
 		return errCode::eNoMemory;
 	return errCode::eSuccess;
@@ -263,6 +355,9 @@ int64_t sys::detail::MemoryInteract::mremap(env::guest_t old_addr, uint64_t old_
 		return errCode::eFault;
 	uint32_t usage = env::Instance()->memory().getUsage(old_addr);
 
+	/* release the affected file-mappings (ensure the old range can be cleared without affecting other shared mappings) */
+	fDropMappings(old_addr, end - old_addr, detail::IsSet(flags, consts::mmvDontUnmap));
+
 	/* check if the memory should be increased in-place */
 	if (!detail::IsSet(flags, consts::mmvMayMove)) {
 		if (detail::IsSet(flags, consts::mmvFixed) || detail::IsSet(flags, consts::mmvDontUnmap))
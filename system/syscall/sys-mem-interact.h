@@ -38,13 +38,26 @@ namespace sys::detail {
 		static constexpr uint64_t mmvMask = consts::mmvMayMove | consts::mmvFixed | consts::mmvDontUnmap;
 	}
 
+	struct BreakState {
+		env::guest_t init = 0;
+		env::guest_t current = 0;
+		env::guest_t aligned = 0;
+	};
+
+	/* read-only private file-mapping, which is populated lazily and can be shared with identical mappings */
+	struct FileMapping {
+		uint64_t size = 0;
+		uint64_t id = 0;
+		uint64_t offset = 0;
+		uint64_t fileSize = 0;
+		uint64_t modifiedUS = 0;
+		uint32_t usage = 0;
+	};
+
 	class MemoryInteract {
 	private:
-		struct {
-			env::guest_t init = 0;
-			env::guest_t current = 0;
-			env::guest_t aligned = 0;
-		} pBrk;
+		std::map<env::guest_t, detail::FileMapping> pMappings;
+		detail::BreakState pBrk;
 		env::guest_t pPageSize = 0;
 		detail::Syscall* pSyscall = 0;
 
@@ -55,10 +68,15 @@ namespace sys::detail {
 		env::guest_t fPageOffset(env::guest_t address) const;
 		env::guest_t fPageAlignUp(env::guest_t address) const;
 		bool fCheckRange(env::guest_t address, uint64_t length, bool replace);
-		int64_t fMapRange(env::guest_t address, uint64_t length, uint32_t usage, uint32_t flags);
+		int64_t fMapRange(env::guest_t address, uint64_t length, uint32_t usage, uint32_t flags, std::optional<env::guest_t> source);
+		void fUnshare(env::guest_t address, uint64_t length);
+		void fDropMappings(env::guest_t address, uint64_t length, bool unshare);
 
 	public:
 		bool setup(detail::Syscall* syscall, env::guest_t endOfData);
+		const detail::BreakState& breakState() const;
+		void restoreBreak(const detail::BreakState& state);
+		void resetMappings();
 		int64_t brk(env::guest_t address);
 		int64_t mmap(env::guest_t address, uint64_t length, uint32_t protect, uint32_t flags, int64_t fd, uint64_t offset);
 		int64_t mprotect(env::guest_t address, uint64_t length, uint32_t protect);
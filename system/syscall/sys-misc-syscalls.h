@@ -31,18 +31,6 @@ namespace sys::detail {
 
 		/* used by sysinfo */
 		static constexpr uint64_t fullSingleCoreLoad = 65536;
-
-		/* used by futex */
-		static constexpr int64_t futexWait = 0;
-		static constexpr int64_t futexWake = 1;
-		static constexpr int64_t futexFd = 2;
-		static constexpr int64_t futexRequeue = 3;
-		static constexpr int64_t futexCmpRequeue = 4;
-		static constexpr int64_t futexWakeOp = 5;
-		static constexpr int64_t futexWaitBitSet = 9;
-		static constexpr int64_t futexWakeBitSet = 10;
-		static constexpr int64_t futexFlagPrivateFlag = 0x0080;
-		static constexpr int64_t futexFlagClockRealTime = 0x0100;
 	}
 
 	class MiscSyscalls {
@@ -69,7 +57,6 @@ namespace sys::detail {
 		int64_t set_robust_list(env::guest_t head, uint64_t size) const;
 		int64_t prlimit64(uint64_t pid, uint64_t res, env::guest_t new_rlim, env::guest_t old_rlim) const;
 		int64_t getrandom(env::guest_t buf, uint64_t buflen, uint32_t flags) const;
-		int64_t futex(env::guest_t uaddr, int64_t futex_op, uint32_t val, env::guest_t timeout, env::guest_t uaddr2, uint32_t val3) const;
 		int64_t rt_sigprocmask(int64_t how, env::guest_t set, env::guest_t oldset, uint64_t sigsetsize) const;
 		int64_t tgkill(uint64_t tgid, uint64_t tid, int64_t sig) const;
 	};
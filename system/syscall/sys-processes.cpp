@@ -0,0 +1,237 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include "../system.h"
+
+static util::Logger logger{ u8"sys::syscall" };
+
+struct sys::detail::Processes::Suspended {
+	std::vector<std::pair<env::guest_t, uint64_t>> regions;
+	std::vector<uint8_t> context;
+	std::map<uint32_t, int32_t> zombies;
+	detail::ImageConfig image;
+	detail::ProcessConfig process;
+	detail::BreakState brk;
+	detail::FileIO::Table files;
+	env::guest_t pc = 0;
+	env::guest_t stash = 0;
+	bool sharedVM = false;
+	bool executed = false;
+};
+
+sys::detail::Processes::Processes() = default;
+sys::detail::Processes::~Processes() = default;
+
+void sys::detail::Processes::fReleaseStash(const Processes::Suspended& parent) const {
+	env::Memory& mem = env::Instance()->memory();
+
+	/* unmap the memory of the parent from its stash (the physical memory remains used by any range sharing it) */
+	for (const auto& [address, size] : parent.regions) {
+		if (!mem.munmap(parent.stash + address, size))
+			logger.fatal(u8"Failed to release stashed memory of process [", parent.process.pid, u8']');
+	}
+}
+void sys::detail::Processes::fRestoreMemory(const Processes::Suspended& parent) const {
+	env::Memory& mem = env::Instance()->memory();
+
+	/* collect the regions of the parent, which the child has neither written to, nor unmapped or changed otherwise (to be kept as they are, which preserves their translated blocks) */
+	std::vector<std::pair<env::guest_t, uint64_t>> kept, changed;
+	for (const auto& [address, size] : parent.regions)
+		(mem.isShared(address, parent.stash + address, size) ? kept : changed).push_back({ address, size });
+
+	/* collect the mappings of the child (before unmapping anything, as unmapping might merge/split the remaining mappings) */
+	std::vector<std::pair<env::guest_t, uint64_t>> mappings;
+	for (auto [address, size] = mem.findNext(0); size > 0 && address < detail::ForkStashAddress; std::tie(address, size) = mem.findNext(address + size))
+		mappings.push_back({ address, std::min<uint64_t>(size, detail::ForkStashAddress - address) });
+
+	/* unmap all mappings of the child, which do not lie within the kept regions (both lists are sorted) */
+	size_t next = 0;
+	for (const auto& [address, size] : mappings) {
+		env::guest_t current = address, end = address + size;
+		while (current < end) {
+			while (next < kept.size() && kept[next].first + kept[next].second <= current)
+				++next;
+			env::guest_t until = (next < kept.size() ? std::min<env::guest_t>(std::max<env::guest_t>(kept[next].first, current), end) : end);
+			if (until > current && !mem.munmap(current, until - current))
+				logger.fatal(u8"Failed to release memory of process [", pSyscall->process().pid, u8']');
+			current = (next < kept.size() && until < end ? std::min<env::guest_t>(kept[next].first + kept[next].second, end) : end);
+		}
+	}
+
+	/* share the changed regions of the parent back from its stash, and release the stash */
+	for (const auto& [address, size] : changed) {
+		if (!mem.mshare(address, parent.stash + address, size))
+			logger.fatal(u8"Failed to restore memory of process [", parent.process.pid, u8']');
+	}
+	fReleaseStash(parent);
+}
+
+bool sys::detail::Processes::setup(detail::Syscall* syscall, sys::Userspace* userspace) {
+	pSyscall = syscall;
+	pUserspace = userspace;
+	return true;
+}
+bool sys::detail::Processes::switchPending() {
+	bool switched = pSwitched;
+	pSwitched = false;
+	return switched;
+}
+bool sys::detail::Processes::nested() const {
+	return !pSuspended.empty();
+}
+void sys::detail::Processes::executed(env::guest_t endOfData, const std::u8string& actual) {
+	detail::ProcessConfig& config = pSyscall->process();
+
+	/* the new image only consists of the calling thread, which takes over the process-id */
+	config.path = actual;
+	config.tid = config.pid;
+	config.clear_child_tid = 0;
+	pExecuted = true;
+	pSyscall->threads().restart();
+
+	/* release the close-on-execute descriptors and setup the initial break of the new image */
+	pSyscall->files().fdExecute();
+	pSyscall->memory().restoreBreak(detail::BreakState{ endOfData, endOfData, endOfData });
+	pSyscall->memory().resetMappings();
+	pSwitched = true;
+}
+
+int64_t sys::detail::Processes::fork(uint64_t flags, env::guest_t stack, env::guest_t parent_tid, env::guest_t tls, env::guest_t child_tid) {
+	/* validate the flags (the parent is suspended until the child exits, therefore shared address-spaces only affect the memory restored for the parent) */
+	if ((flags & ~consts::cloneProcessSupported) != 0) {
+		logger.warn(u8"Unsupported clone flags [", str::As{ U"#010x", flags }, u8"] used for process");
+		return errCode::eNotImplemented;
+	}
+	if (pSyscall->threads().count() > 1) {
+		logger.warn(u8"Fork of processes with multiple threads is not supported");
+		return errCode::eNotImplemented;
+	}
+	if (pSuspended.size() + 1 >= detail::MaxProcessCount)
+		return errCode::eAgain;
+
+	/* collect the memory of the parent and ensure it fits into the stash */
+	env::Memory& mem = env::Instance()->memory();
+	std::vector<std::pair<env::guest_t, uint64_t>> regions;
+	for (auto [address, size] = mem.findNext(0); size > 0 && address < detail::ForkStashAddress; std::tie(address, size) = mem.findNext(address + size)) {
+		if (address + size > detail::ForkStashSize) {
+			logger.warn(u8"Fork of processes with memory beyond [", str::As{ U"#018x", detail::ForkStashSize }, u8"] is not supported");
+			return errCode::eNoMemory;
+		}
+		regions.push_back({ address, size });
+	}
+	uint32_t pid = pSyscall->threads().allocateId();
+
+	/* write the process-id to the parent before it is suspended */
+	if (detail::IsSet(flags, consts::cloneParentSetTid))
+		mem.write<uint32_t>(parent_tid, pid);
+
+	/* suspend the parent (context is captured before the result is written, which will be the id of the child once resumed) */
+	Suspended& parent = pSuspended.emplace_back();
+	parent.regions = std::move(regions);
+	parent.stash = detail::ForkStashAddress + (pSuspended.size() - 1) * detail::ForkStashSize;
+	parent.context = env::Instance()->context().save();
+	parent.zombies = std::move(pZombies);
+	parent.image = pUserspace->image();
+	parent.process = pSyscall->process();
+	parent.brk = pSyscall->memory().breakState();
+	parent.files = pSyscall->files().fdFork();
+	parent.pc = pUserspace->getPC();
+	parent.sharedVM = detail::IsSet(flags, consts::cloneVM);
+	parent.executed = pExecuted;
+	pZombies.clear();
+	pExecuted = false;
+
+	/* share the memory of the parent into its stash without copying it (pages are only copied, once the child writes to
+	*	them, unless the address-space is shared, in which case the stash only preserves the memory for an executing child) */
+	for (const auto& [address, size] : parent.regions) {
+		if (!(parent.sharedVM ? mem.mshare(parent.stash + address, address, size) : mem.mclone(parent.stash + address, address, size)))
+			logger.fatal(u8"Failed to stash memory of process [", parent.process.pid, u8']');
+	}
+
+	/* setup the child as copy of the parent, which resumes after the syscall */
+	detail::ProcessConfig& config = pSyscall->process();
+	config.pid = pid;
+	config.tid = pid;
+	config.clear_child_tid = (detail::IsSet(flags, consts::cloneChildClearTid) ? child_tid : 0);
+	pSyscall->threads().restart();
+	pUserspace->cpu()->setupThread(stack, tls, detail::IsSet(flags, consts::cloneSetTls));
+	if (detail::IsSet(flags, consts::cloneChildSetTid))
+		mem.write<uint32_t>(child_tid, pid);
+	logger.debug(u8"Process [", pid, u8"] forked from [", parent.process.pid, u8']');
+	return errCode::eSuccess;
+}
+int64_t sys::detail::Processes::execve(std::u8string_view path, std::vector<std::u8string> args, std::vector<std::u8string> envs) {
+	if (path.empty())
+		return errCode::eNoEntry;
+
+	/* resolve the path relative to the working directory (looked up on the host filesystem, like the initial binary) */
+	std::u8string actual = util::MergePaths(pSyscall->process().workingDirectory, path);
+	return pUserspace->execve(actual, std::move(args), std::move(envs));
+}
+int64_t sys::detail::Processes::exit(int32_t status, env::guest_t address) {
+	/* check if this is the initial process, in which case the entire environment terminates */
+	if (pSuspended.empty())
+		env::Instance()->context().terminate(status, address);
+	uint32_t pid = pSyscall->process().pid;
+	logger.debug(u8"Process [", pid, u8"] exited with [", status, u8']');
+
+	/* fetch the suspended parent */
+	Suspended parent = std::move(pSuspended.back());
+	pSuspended.pop_back();
+
+	/* restore the memory of the parent, unless the child shared it and did not replace it by executing another image, as its writes
+	*	must remain visible to the parent (e.g. the error of a failed posix_spawn), and restore the context of the parent */
+	if (!parent.sharedVM || pExecuted)
+		fRestoreMemory(parent);
+	else
+		fReleaseStash(parent);
+	pExecuted = parent.executed;
+	env::Instance()->context().restore(parent.context);
+	pUserspace->setPC(parent.pc);
+	pUserspace->restoreImage(parent.image);
+
+	/* restore the syscall-state of the parent */
+	pSyscall->process() = parent.process;
+	pSyscall->memory().restoreBreak(parent.brk);
+	pSyscall->memory().resetMappings();
+	pSyscall->files().fdRestore(std::move(parent.files));
+	pSyscall->threads().restart();
+
+	/* register the child to be waited upon and resume the parent with the id of the child as result of its fork */
+	pZombies = std::move(parent.zombies);
+	pZombies[pid] = status;
+	pSwitched = true;
+	return pid;
+}
+int64_t sys::detail::Processes::wait4(int64_t pid, env::guest_t wstatus, uint64_t options, env::guest_t rusage) {
+	if ((options & ~consts::waitMask) != 0) {
+		logger.warn(u8"Unsupported wait options [", str::As{ U"#010x", options }, u8"] used");
+		return errCode::eInvalid;
+	}
+
+	/* lookup the child (children run to completion before the parent resumes, therefore only exited children can exist, and all share the process-group) */
+	auto it = pZombies.end();
+	if (pid > 0)
+		it = pZombies.find(uint32_t(pid));
+	else if (pid == -1 || pid == 0 || uint64_t(-pid) == pSyscall->process().pgid)
+		it = pZombies.begin();
+	if (it == pZombies.end())
+		return errCode::eChild;
+
+	/* write the exit-status and the empty resource-usage out */
+	env::Memory& mem = env::Instance()->memory();
+	if (wstatus != 0)
+		mem.write<uint32_t>(wstatus, (uint32_t(it->second) & 0xff) << 8);
+	if (rusage != 0)
+		mem.mclear(rusage, consts::waitRUsageSize, env::Usage::Write);
+
+	/* release the child */
+	uint32_t child = it->first;
+	pZombies.erase(it);
+	return child;
+}
+int64_t sys::detail::Processes::getppid() const {
+	/* the initial process has no visible parent */
+	if (pSuspended.empty())
+		return 0;
+	return pSuspended.back().process.pid;
+}
@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "../sys-common.h"
+#include "sys-threads.h"
+
+namespace sys::detail {
+	static constexpr size_t MaxExecuteRedirects = 4;
+
+	/* the memory of suspended parents is shared into the upper half of the address-space, which cannot be mapped by the guest,
+	*	with one slot of the given size per nesting level (the guest memory must therefore lie within the size of a slot) */
+	static constexpr env::guest_t ForkStashAddress = 0x8000'0000'0000'0000;
+	static constexpr env::guest_t ForkStashSize = 0x0800'0000'0000'0000;
+
+	namespace consts {
+		/* used by clone (for processes) */
+		static constexpr uint64_t cloneVFork = 0x00004000;
+		static constexpr uint64_t cloneProcessSupported = consts::cloneSignalMask | consts::cloneVM | consts::cloneVFork | consts::cloneSetTls
+			| consts::cloneParentSetTid | consts::cloneChildClearTid | consts::cloneChildSetTid;
+
+		/* used by wait4 */
+		static constexpr uint64_t waitNoHang = 0x00000001;
+		static constexpr uint64_t waitUntraced = 0x00000002;
+		static constexpr uint64_t waitAll = 0x40000000;
+		static constexpr uint64_t waitClone = 0x80000000;
+		static constexpr uint64_t waitMask = consts::waitNoHang | consts::waitUntraced | consts::waitAll | consts::waitClone;
+		static constexpr size_t waitRUsageSize = 144;
+	}
+
+	/* defined by the userspace-profiler */
+	struct ProfileImage;
+
+	/* description of the loaded image, which is required to setup the initial stack */
+	struct ImageConfig {
+		std::vector<std::u8string> args;
+		std::vector<std::u8string> envs;
+		std::u8string binary;
+		std::u8string actual;
+		std::shared_ptr<const detail::ProfileImage> profile;
+	};
+
+	/* sequential process model, in which a forked child runs to completion within the same
+	*	environment while the parent is suspended, after which the parent is resumed with its
+	*	memory, context, and descriptors restored (translated blocks of unchanged executable
+	*	memory and produced blocks of the warm-cache remain valid across all processes)
+	*	Note: the memory of the parent is shared with the child and only copied upon writes (copy-on-write)
+	*	Note: children sharing the address-space (vfork) keep their memory-writes, unless they execute another image
+	*	Note: as the parent does not run concurrently to the child, pipelines between them are not supported */
+	class Processes {
+	private:
+		/* defined with the implementation, as it depends on the state of the other syscall-components */
+		struct Suspended;
+
+	private:
+		std::vector<Processes::Suspended> pSuspended;
+		std::map<uint32_t, int32_t> pZombies;
+		detail::Syscall* pSyscall = 0;
+		sys::Userspace* pUserspace = 0;
+		bool pSwitched = false;
+		bool pExecuted = false;
+
+	public:
+		Processes();
+		~Processes();
+
+	private:
+		void fReleaseStash(const Processes::Suspended& parent) const;
+		void fRestoreMemory(const Processes::Suspended& parent) const;
+
+	public:
+		bool setup(detail::Syscall* syscall, sys::Userspace* userspace);
+		bool switchPending();
+		bool nested() const;
+		void executed(env::guest_t endOfData, const std::u8string& actual);
+
+	public:
+		int64_t fork(uint64_t flags, env::guest_t stack, env::guest_t parent_tid, env::guest_t tls, env::guest_t child_tid);
+		int64_t execve(std::u8string_view path, std::vector<std::u8string> args, std::vector<std::u8string> envs);
+		int64_t exit(int32_t status, env::guest_t address);
+		int64_t wait4(int64_t pid, env::guest_t wstatus, uint64_t options, env::guest_t rusage);
+		int64_t getppid() const;
+	};
+}
@@ -14,6 +14,19 @@ std::u8string sys::detail::Syscall::fReadString(env::guest_t address) const {
 
 	return out;
 }
+std::vector<std::u8string> sys::detail::Syscall::fReadStringArray(env::guest_t address) const {
+	env::Memory& mem = env::Instance()->memory();
+	std::vector<std::u8string> out;
+
+	/* read the null-terminated array of string-pointers (null-array is considered empty) */
+	if (address == 0)
+		return out;
+	for (env::guest_t ptr = mem.read<uint64_t>(address); ptr != 0; ptr = mem.read<uint64_t>(address)) {
+		out.push_back(fReadString(ptr));
+		address += sizeof(uint64_t);
+	}
+	return out;
+}
 
 void sys::detail::Syscall::fWrap(bool inplace, std::function<int64_t()> callback) {
 	/* execute the wrapped call (to catch any memory exceptions and nested incomplete-calls) */
@@ -34,6 +47,8 @@ void sys::detail::Syscall::fWrap(bool inplace, std::function<int64_t()> callback
 	*	case the execution needs to be propagated further down (exception cannot be
 	*	thrown from outside, as they will otherwise be passed out of the application) */
 	if (pCurrent.nested > 0 || !pCurrent.completed) {
+		/* control is returned to the host until the call completes, therefore pass the buffered output out */
+		host::FlushOut();
 		if (inplace)
 			throw detail::AwaitingSyscall{};
 		return;
@@ -43,6 +58,17 @@ void sys::detail::Syscall::fWrap(bool inplace, std::function<int64_t()> callback
 	logger.debug(u8"result: ", str::As{ U"#018x", pCurrent.result });
 	pUserspace->cpu()->syscallSetResult(pCurrent.result);
 
+	/* check if another thread or process is to be executed, in which case the in-place execution needs to be unwound */
+	bool switched = pProcesses.switchPending();
+	if (pThreads.switchPending()) {
+		pThreads.switchThread();
+		switched = true;
+	}
+	if (switched)
+		host::FlushOut();
+	if (switched && inplace)
+		throw detail::ThreadSwitch{};
+
 	/* check if this is not in-place execution, in which case the execution needs to be continued in this call */
 	if (!inplace) {
 		pUserspace->execute();
@@ -52,57 +78,125 @@ void sys::detail::Syscall::fWrap(bool inplace, std::function<int64_t()> callback
 	/* perform the check if the execution can continue at the next address (will also check for memory-invalidations) */
 	pUserspace->checkContinue();
 }
-int64_t sys::detail::Syscall::fDispatch() {
-	sys::SyscallArgs syscall = pUserspace->cpu()->syscallGetArgs();
+bool sys::detail::Syscall::fDispatchFast(const sys::SyscallArgs& syscall, int64_t& result) {
 	const uint64_t(&args)[6] = syscall.args;
 
-	/* check if the syscall can be handled in-place */
+	/* check if the syscall is always completed synchronously without affecting the control-flow */
 	switch (syscall.index) {
 	case sys::SyscallIndex::getuid: {
 		logger.debug(u8"Syscall getuid()");
-		return pMisc.getuid();
+		result = pMisc.getuid();
+		return true;
 	}
 	case sys::SyscallIndex::geteuid: {
 		logger.debug(u8"Syscall geteuid()");
-		return pMisc.geteuid();
+		result = pMisc.geteuid();
+		return true;
 	}
 	case sys::SyscallIndex::getgid: {
 		logger.debug(u8"Syscall getgid()");
-		return pMisc.getgid();
+		result = pMisc.getgid();
+		return true;
 	}
 	case sys::SyscallIndex::getegid: {
 		logger.debug(u8"Syscall getegid()");
-		return pMisc.getegid();
+		result = pMisc.getegid();
+		return true;
 	}
 	case sys::SyscallIndex::getpid: {
 		logger.debug(u8"Syscall getpid()");
-		return pMisc.getpid();
+		result = pMisc.getpid();
+		return true;
 	}
 	case sys::SyscallIndex::gettid: {
 		logger.debug(u8"Syscall gettid()");
-		return pMisc.gettid();
+		result = pMisc.gettid();
+		return true;
 	}
 	case sys::SyscallIndex::gettimeofday: {
 		logger.debug(u8"Syscall gettimeofday(", str::As{ U"#018x", args[0] }, u8", ", str::As{ U"#018x", args[1] }, u8')');
-		return pMisc.gettimeofday(args[0], args[1]);
+		result = pMisc.gettimeofday(args[0], args[1]);
+		return true;
 	}
 	case sys::SyscallIndex::clock_gettime: {
 		logger.debug(u8"Syscall clock_gettime(", args[0], u8", ", str::As{ U"#018x", args[1] }, u8')');
-		return pMisc.clock_gettime(args[0], args[1]);
+		result = pMisc.clock_gettime(args[0], args[1]);
+		return true;
+	}
+	case sys::SyscallIndex::getppid: {
+		logger.debug(u8"Syscall getppid()");
+		result = pProcesses.getppid();
+		return true;
+	}
+	case sys::SyscallIndex::brk: {
+		logger.debug(u8"Syscall brk(", str::As{ U"#018x", args[0] }, u8')');
+		result = pMemory.brk(args[0]);
+		return true;
+	}
+	case sys::SyscallIndex::getrandom: {
+		logger.debug(u8"Syscall getrandom(", str::As{ U"#018x", args[0] }, u8", ", args[1], u8", ", args[2], u8')');
+		result = pMisc.getrandom(args[0], args[1], uint32_t(args[2]));
+		return true;
+	}
+	case sys::SyscallIndex::rt_sigprocmask: {
+		logger.debug(u8"Syscall rt_sigprocmask(", int64_t(args[0]), u8", ", str::As{ U"#018x", args[1] }, u8", ", str::As{ U"#010x", args[2] }, u8", ", args[3], u8')');
+		result = pMisc.rt_sigprocmask(int64_t(args[0]), args[1], args[2], args[3]);
+		return true;
 	}
+	case sys::SyscallIndex::completed: {
+		logger.debug(u8"Syscall completed(index: ", syscall.rawIndex, u8')');
+		result = args[0];
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+int64_t sys::detail::Syscall::fDispatch() {
+	sys::SyscallArgs syscall = pUserspace->cpu()->syscallGetArgs();
+	const uint64_t(&args)[6] = syscall.args;
+
+	/* check if the syscall is one of the simple synchronous calls */
+	int64_t result = 0;
+	if (fDispatchFast(syscall, result))
+		return result;
+
+	/* check if the syscall can be handled in-place */
+	switch (syscall.index) {
 	case sys::SyscallIndex::exit_group: {
 		logger.debug(u8"Syscall exit_group(", args[0], u8')');
-		env::Instance()->context().terminate(int32_t(int64_t(args[0])), pCurrent.address);
-		return errCode::eSuccess;
+		host::FlushOut();
+		return pProcesses.exit(int32_t(int64_t(args[0])), pCurrent.address);
+	}
+	case sys::SyscallIndex::exit: {
+		logger.debug(u8"Syscall exit(", args[0], u8')');
+		host::FlushOut();
+		return pThreads.exit(int32_t(int64_t(args[0])), pCurrent.address);
+	}
+	case sys::SyscallIndex::clone: {
+		logger.debug(u8"Syscall clone(", str::As{ U"#010x", args[0] }, u8", ", str::As{ U"#018x", args[1] }, u8", ", str::As{ U"#018x", args[2] }, u8", ", str::As{ U"#018x", args[3] }, u8", ", str::As{ U"#018x", args[4] }, u8')');
+		if (detail::IsSet(args[0], consts::cloneThread))
+			return pThreads.clone(args[0], args[1], args[2], args[3], args[4]);
+		return pProcesses.fork(args[0], args[1], args[2], args[3], args[4]);
+	}
+	case sys::SyscallIndex::execve: {
+		logger.debug(u8"Syscall execve(", str::As{ U"#018x", args[0] }, u8", ", str::As{ U"#018x", args[1] }, u8", ", str::As{ U"#018x", args[2] }, u8')');
+		std::u8string path = fReadString(args[0]);
+		logger.debug(u8"pathname: [", path, u8']');
+		return pProcesses.execve(path, fReadStringArray(args[1]), fReadStringArray(args[2]));
+	}
+	case sys::SyscallIndex::wait4: {
+		logger.debug(u8"Syscall wait4(", int64_t(args[0]), u8", ", str::As{ U"#018x", args[1] }, u8", ", args[2], u8", ", str::As{ U"#018x", args[3] }, u8')');
+		return pProcesses.wait4(int64_t(args[0]), args[1], args[2], args[3]);
+	}
+	case sys::SyscallIndex::sched_yield: {
+		logger.debug(u8"Syscall sched_yield()");
+		return pThreads.sched_yield();
 	}
 	case sys::SyscallIndex::tgkill: {
 		logger.debug(u8"Syscall tgkill(", args[0], args[1], int64_t(args[2]), u8')');
 		return pMisc.tgkill(args[0], args[1], int64_t(args[2]));
 	}
-	case sys::SyscallIndex::brk: {
-		logger.debug(u8"Syscall brk(", str::As{ U"#018x", args[0] }, u8')');
-		return pMemory.brk(args[0]);
-	}
 	case sys::SyscallIndex::mmap: {
 		logger.debug(u8"Syscall mmap(", str::As{ U"#018x", args[0] }, u8", ", str::As{ U"#010x", args[1] }, u8", ", args[2], u8", ", args[3], u8", ", int64_t(args[4]), u8", ", args[5], u8')');
 		return pMemory.mmap(args[0], args[1], uint32_t(args[2]), uint32_t(args[3]), args[4], args[5]);
@@ -237,21 +331,14 @@ int64_t sys::detail::Syscall::fDispatch() {
 		logger.debug(u8"Syscall prlimit64(", args[0], u8", ", args[1], u8", ", str::As{ U"#018x", args[2] }, u8", ", str::As{ U"#018x", args[3] }, u8')');
 		return pMisc.prlimit64(args[0], args[1], args[2], args[3]);
 	}
-	case sys::SyscallIndex::getrandom: {
-		logger.debug(u8"Syscall getrandom(", str::As{ U"#018x", args[0] }, u8", ", args[1], u8", ", args[2], u8')');
-		return pMisc.getrandom(args[0], args[1], uint32_t(args[2]));
-	}
 	case sys::SyscallIndex::futex: {
 		logger.debug(u8"Syscall futex(", str::As{ U"#018x", args[0] }, u8", ", int64_t(args[1]), u8", ", uint32_t(args[2]), u8", ", str::As{ U"#010x", args[3] }, u8", ", str::As{ U"#010x", args[4] }, u8", ", uint32_t(args[5]), u8')');
-		return pMisc.futex(args[0], int64_t(args[1]), uint32_t(args[2]), args[3], args[4], uint32_t(args[5]));
+		host::FlushOut();
+		return pThreads.futex(args[0], int64_t(args[1]), uint32_t(args[2]), args[3], args[4], uint32_t(args[5]));
 	}
-	case sys::SyscallIndex::rt_sigprocmask: {
-		logger.debug(u8"Syscall rt_sigprocmask(", int64_t(args[0]), u8", ", str::As{ U"#018x", args[1] }, u8", ", str::As{ U"#010x", args[2] }, u8", ", args[3], u8')');
-		return pMisc.rt_sigprocmask(int64_t(args[0]), args[1], args[2], args[3]);
-	}
-	case sys::SyscallIndex::completed: {
-		logger.debug(u8"Syscall completed(index: ", syscall.rawIndex, u8')');
-		return args[0];
+	case sys::SyscallIndex::checkpoint: {
+		logger.debug(u8"Syscall checkpoint()");
+		return pUserspace->checkpoint();
 	}
 	case sys::SyscallIndex::unknown:
 		throw detail::UnknownSyscall{ pCurrent.address, syscall.rawIndex };
@@ -265,6 +352,26 @@ int64_t sys::detail::Syscall::fDispatch() {
 	return errCode::eUnknown;
 }
 
+bool sys::detail::Syscall::IsFast(sys::SyscallIndex index) {
+	switch (index) {
+	case sys::SyscallIndex::getuid:
+	case sys::SyscallIndex::geteuid:
+	case sys::SyscallIndex::getgid:
+	case sys::SyscallIndex::getegid:
+	case sys::SyscallIndex::getpid:
+	case sys::SyscallIndex::gettid:
+	case sys::SyscallIndex::gettimeofday:
+	case sys::SyscallIndex::clock_gettime:
+	case sys::SyscallIndex::getppid:
+	case sys::SyscallIndex::brk:
+	case sys::SyscallIndex::getrandom:
+	case sys::SyscallIndex::rt_sigprocmask:
+	case sys::SyscallIndex::completed:
+		return true;
+	default:
+		return false;
+	}
+}
 bool sys::detail::Syscall::setup(sys::Userspace* userspace, env::guest_t endOfData, std::u8string_view path, std::u8string_view machine) {
 	pUserspace = userspace;
 	pConfig.path = std::u8string{ path };
@@ -282,9 +389,48 @@ bool sys::detail::Syscall::setup(sys::Userspace* userspace, env::guest_t endOfDa
 	/* setup the remaining syscalls */
 	if (!pMisc.setup(this))
 		return false;
+
+	/* setup the thread-management */
+	if (!pThreads.setup(this, userspace))
+		return false;
+
+	/* setup the process-management */
+	if (!pProcesses.setup(this, userspace))
+		return false;
 	return true;
 }
+void sys::detail::Syscall::handleFast(env::guest_t address, env::guest_t nextAddress) {
+	/* multiple threads require the generic path, as it performs the time-slicing (without crossing to the host again) */
+	if (pThreads.count() > 1) {
+		handle(address, nextAddress);
+		return;
+	}
+	host::FlushOutExpired();
+
+	/* perform the call directly (without the wrapping and exceptions of the generic path) */
+	int64_t result = 0;
+	bool handled = true;
+	try {
+		handled = fDispatchFast(pUserspace->cpu()->syscallGetArgs(), result);
+	}
+	catch (const env::MemoryFault& e) {
+		logger.debug(u8"Memory fault at [", str::As{ U"#018x", e.accessed }, u8"] while handling syscall");
+		result = errCode::eFault;
+	}
+	if (!handled) {
+		handle(address, nextAddress);
+		return;
+	}
+
+	/* write the result back and check if the execution can continue at the next address */
+	logger.debug(u8"result: ", str::As{ U"#018x", result });
+	pUserspace->setPC(nextAddress);
+	pUserspace->cpu()->syscallSetResult(result);
+	pUserspace->checkContinue();
+}
 void sys::detail::Syscall::handle(env::guest_t address, env::guest_t nextAddress) {
+	host::FlushOutExpired();
+
 	/* update the pc to already point to the next address */
 	pUserspace->setPC(nextAddress);
 
@@ -306,6 +452,21 @@ sys::detail::ProcessConfig& sys::detail::Syscall::process() {
 sys::detail::FileIO& sys::detail::Syscall::files() {
 	return pFileIO;
 }
+sys::detail::MemoryInteract& sys::detail::Syscall::memory() {
+	return pMemory;
+}
+const sys::detail::Threads& sys::detail::Syscall::threads() const {
+	return pThreads;
+}
+sys::detail::Threads& sys::detail::Syscall::threads() {
+	return pThreads;
+}
+const sys::detail::Processes& sys::detail::Syscall::processes() const {
+	return pProcesses;
+}
+sys::detail::Processes& sys::detail::Syscall::processes() {
+	return pProcesses;
+}
 int64_t sys::detail::Syscall::callIncomplete() {
 	throw detail::AwaitingSyscall{};
 }
@@ -7,6 +7,8 @@
 #include "sys-file-io.h"
 #include "sys-mem-interact.h"
 #include "sys-misc-syscalls.h"
+#include "sys-threads.h"
+#include "sys-processes.h"
 
 namespace sys::detail {
 	namespace fs {
@@ -47,6 +49,8 @@ namespace sys::detail {
 		detail::FileIO pFileIO;
 		detail::MemoryInteract pMemory;
 		detail::MiscSyscalls pMisc;
+		detail::Threads pThreads;
+		detail::Processes pProcesses;
 		struct {
 			env::guest_t address = 0;
 			size_t nested = 0;
@@ -60,19 +64,31 @@ namespace sys::detail {
 
 	private:
 		std::u8string fReadString(env::guest_t address) const;
+		std::vector<std::u8string> fReadStringArray(env::guest_t address) const;
 
 	private:
 		void fWrap(bool inplace, std::function<int64_t()> callback);
+		bool fDispatchFast(const sys::SyscallArgs& syscall, int64_t& result);
 		int64_t fDispatch();
 
 	public:
 		bool setup(sys::Userspace* userspace, env::guest_t endOfData, std::u8string_view path, std::u8string_view machine);
+		void handleFast(env::guest_t address, env::guest_t nextAddress);
 		void handle(env::guest_t address, env::guest_t nextAddress);
 
+	public:
+		/* check if the syscall is always completed synchronously without affecting the control-flow (must match fDispatchFast) */
+		static bool IsFast(sys::SyscallIndex index);
+
 	public:
 		const detail::ProcessConfig& process() const;
 		detail::ProcessConfig& process();
 		detail::FileIO& files();
+		detail::MemoryInteract& memory();
+		const detail::Threads& threads() const;
+		detail::Threads& threads();
+		const detail::Processes& processes() const;
+		detail::Processes& processes();
 		int64_t callIncomplete();
 		void callContinue(std::function<int64_t()> callback);
 	};
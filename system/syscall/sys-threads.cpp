@@ -0,0 +1,352 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include "../system.h"
+
+static util::Logger logger{ u8"sys::syscall" };
+
+uint32_t sys::detail::Threads::fNextRunnable(bool expireTimeouts) {
+	/* expire all timed waits, whose deadline has passed on the host-time (the woken threads report the timeout) */
+	uint64_t now = host::GetStampUS();
+	for (auto& [tid, thread] : pThreads) {
+		if (tid == pCurrent || !thread.waiting || !thread.hasTimeout || thread.deadline > now)
+			continue;
+		logger.debug(u8"Expiring futex-wait of thread [", tid, u8']');
+		thread.waiting = false;
+		thread.timedOut = true;
+	}
+
+	/* round-robin search for the next thread after the current thread, which is not blocked */
+	auto it = pThreads.upper_bound(pCurrent);
+	for (size_t i = 0; i < pThreads.size(); ++i, ++it) {
+		if (it == pThreads.end())
+			it = pThreads.begin();
+		if (it->first != pCurrent && !it->second.waiting)
+			return it->first;
+	}
+	if (!expireTimeouts)
+		return 0;
+
+	/* check if a thread is waiting with a timeout, in which case the earliest deadline is expired prematurely,
+	*	as no other thread could wake it anymore, and the host cannot be blocked until the deadline passes */
+	uint32_t earliest = 0;
+	for (auto& [tid, thread] : pThreads) {
+		if (tid == pCurrent || !thread.waiting || !thread.hasTimeout)
+			continue;
+		if (earliest == 0 || thread.deadline < pThreads.at(earliest).deadline)
+			earliest = tid;
+	}
+	if (earliest == 0)
+		return 0;
+	logger.debug(u8"Expiring futex-wait of thread [", earliest, u8"] prematurely");
+	pThreads.at(earliest).waiting = false;
+	pThreads.at(earliest).timedOut = true;
+	return earliest;
+}
+uint32_t sys::detail::Threads::fWake(env::guest_t uaddr, uint64_t count, uint32_t bitset) {
+	uint32_t woken = 0;
+
+	/* wake up to count threads waiting on the address with an overlapping bitset */
+	for (auto& [tid, thread] : pThreads) {
+		if (woken >= count)
+			break;
+		if (!thread.waiting || thread.futex != uaddr || (thread.bitset & bitset) == 0)
+			continue;
+		thread.waiting = false;
+		++woken;
+	}
+	return woken;
+}
+uint32_t sys::detail::Threads::fRequeue(env::guest_t uaddr, env::guest_t uaddr2, uint64_t count) {
+	uint32_t moved = 0;
+
+	/* move up to count threads waiting on the first address to wait on the second address */
+	for (auto& [tid, thread] : pThreads) {
+		if (moved >= count)
+			break;
+		if (!thread.waiting || thread.futex != uaddr)
+			continue;
+		thread.futex = uaddr2;
+		++moved;
+	}
+	return moved;
+}
+int64_t sys::detail::Threads::fWait(env::guest_t uaddr, uint32_t val, env::guest_t timeout, bool absolute, uint32_t bitset) {
+	if (bitset == 0)
+		return errCode::eInvalid;
+
+	/* check if the value still matches (wait is performed atomically, as no other thread runs concurrently) */
+	if (env::Instance()->memory().read<uint32_t>(uaddr) != val)
+		return errCode::eAgain;
+
+	/* compute the deadline in host-time (all clocks are based on the host-time, and the wait-bitset timeout is absolute) */
+	uint64_t deadline = 0;
+	if (timeout != 0) {
+		linux::TimeSpec spec;
+		env::Instance()->memory().mread(&spec, timeout, sizeof(linux::TimeSpec), env::Usage::Read);
+		if (int64_t(spec.sec) < 0 || spec.nsec >= 1000'000'000)
+			return errCode::eInvalid;
+		uint64_t now = host::GetStampUS();
+		uint64_t span = (spec.sec >= std::numeric_limits<uint64_t>::max() / 1000'000 - 1 ? std::numeric_limits<uint64_t>::max() : spec.sec * 1000'000 + (spec.nsec + 999) / 1000);
+		deadline = (absolute ? span : (span > std::numeric_limits<uint64_t>::max() - now ? std::numeric_limits<uint64_t>::max() : now + span));
+		if (deadline <= now)
+			return errCode::eTimedOut;
+	}
+
+	/* check if another thread can be executed in the meantime */
+	uint32_t next = fNextRunnable(true);
+	if (next == 0) {
+		if (timeout != 0)
+			return errCode::eTimedOut;
+
+		/* no other thread could ever wake this thread up, treat it as a spurious wakeup */
+		logger.warn(u8"Futex-wait on [", str::As{ U"#018x", uaddr }, u8"] by the last runnable thread [", pCurrent, u8"] treated as spurious wakeup");
+		return errCode::eSuccess;
+	}
+
+	/* block the current thread (the result is written to its context before being switched out) */
+	Thread& self = pThreads.at(pCurrent);
+	self.waiting = true;
+	self.hasTimeout = (timeout != 0);
+	self.deadline = deadline;
+	self.timedOut = false;
+	self.futex = uaddr;
+	self.bitset = bitset;
+	pNext = next;
+	return errCode::eSuccess;
+}
+int64_t sys::detail::Threads::fWakeOp(env::guest_t uaddr, uint32_t val, uint64_t val2, env::guest_t uaddr2, uint32_t val3) {
+	env::Memory& mem = env::Instance()->memory();
+
+	/* decode the operation (arguments are sign-extended 12-bit values) */
+	uint32_t op = ((val3 >> 28) & 0x0f), cmp = ((val3 >> 24) & 0x0f);
+	int32_t opArg = (int32_t(val3 << 8) >> 20), cmpArg = (int32_t(val3 << 20) >> 20);
+	if ((op & consts::futexOpArgShift) != 0) {
+		if (opArg < 0 || opArg > 31)
+			return errCode::eInvalid;
+		opArg = int32_t(1u << opArg);
+	}
+
+	/* perform the operation on the second address */
+	int32_t old = mem.read<int32_t>(uaddr2), value = 0;
+	switch (op & ~consts::futexOpArgShift) {
+	case consts::futexOpSet:
+		value = opArg;
+		break;
+	case consts::futexOpAdd:
+		value = int32_t(uint32_t(old) + uint32_t(opArg));
+		break;
+	case consts::futexOpOr:
+		value = (old | opArg);
+		break;
+	case consts::futexOpAndNot:
+		value = (old & ~opArg);
+		break;
+	case consts::futexOpXor:
+		value = (old ^ opArg);
+		break;
+	default:
+		return errCode::eNotImplemented;
+	}
+
+	/* evaluate the comparison of the old value */
+	bool matches = false;
+	switch (cmp) {
+	case consts::futexCmpEqual:
+		matches = (old == cmpArg);
+		break;
+	case consts::futexCmpNotEqual:
+		matches = (old != cmpArg);
+		break;
+	case consts::futexCmpLess:
+		matches = (old < cmpArg);
+		break;
+	case consts::futexCmpLessEqual:
+		matches = (old <= cmpArg);
+		break;
+	case consts::futexCmpGreater:
+		matches = (old > cmpArg);
+		break;
+	case consts::futexCmpGreaterEqual:
+		matches = (old >= cmpArg);
+		break;
+	default:
+		return errCode::eNotImplemented;
+	}
+	mem.write<int32_t>(uaddr2, value);
+
+	/* wake the waiters of both addresses */
+	uint32_t woken = fWake(uaddr, val, consts::futexBitSetMatchAny);
+	if (matches)
+		woken += fWake(uaddr2, val2, consts::futexBitSetMatchAny);
+	return woken;
+}
+
+bool sys::detail::Threads::setup(detail::Syscall* syscall, sys::Userspace* userspace) {
+	pSyscall = syscall;
+	pUserspace = userspace;
+
+	/* register the initial thread (the context is only stored once the thread is switched out) */
+	pCurrent = pSyscall->process().tid;
+	pLastTid = pCurrent;
+	pThreads[pCurrent] = Thread{};
+	pSliceStart = host::GetStampUS();
+	sys::Writer::SetThreaded(false);
+	return true;
+}
+bool sys::detail::Threads::switchPending() {
+	if (pNext != 0)
+		return true;
+	if (pThreads.size() <= 1)
+		return false;
+
+	/* check if the time-slice of the current thread has passed */
+	uint64_t now = host::GetStampUS();
+	if (now - pSliceStart < detail::ThreadSliceUS)
+		return false;
+	pSliceStart = now;
+	pNext = fNextRunnable(false);
+	return (pNext != 0);
+}
+void sys::detail::Threads::switchThread() {
+	env::Context& context = env::Instance()->context();
+	detail::ProcessConfig& config = pSyscall->process();
+
+	/* store the state of the current thread (unless it has already exited) */
+	auto it = pThreads.find(pCurrent);
+	if (it != pThreads.end()) {
+		it->second.context = context.save();
+		it->second.pc = pUserspace->getPC();
+		it->second.clearChildTid = config.clear_child_tid;
+	}
+	logger.debug(u8"Switching from thread [", pCurrent, u8"] to [", pNext, u8']');
+
+	/* restore the state of the next thread */
+	Thread& next = pThreads.at(pNext);
+	pCurrent = pNext;
+	pNext = 0;
+	pSliceStart = host::GetStampUS();
+	context.restore(next.context);
+	next.context.clear();
+	pUserspace->setPC(next.pc);
+	config.tid = pCurrent;
+	config.clear_child_tid = next.clearChildTid;
+
+	/* check if the thread is started for the first time or returns from a timed out futex-wait */
+	if (next.fresh)
+		pUserspace->cpu()->setupThread(next.stack, next.tls, next.setTls);
+	else if (next.timedOut)
+		pUserspace->cpu()->syscallSetResult(errCode::eTimedOut);
+	next.fresh = false;
+	next.timedOut = false;
+}
+size_t sys::detail::Threads::count() const {
+	return pThreads.size();
+}
+uint32_t sys::detail::Threads::allocateId() {
+	/* thread-ids and process-ids share the same id-space */
+	return ++pLastTid;
+}
+void sys::detail::Threads::restart() {
+	/* drop all threads and register the thread of the current process as the only thread */
+	pThreads.clear();
+	pCurrent = pSyscall->process().tid;
+	pNext = 0;
+	pThreads[pCurrent] = Thread{};
+	pSliceStart = host::GetStampUS();
+	sys::Writer::SetThreaded(false);
+}
+
+int64_t sys::detail::Threads::clone(uint64_t flags, env::guest_t stack, env::guest_t parent_tid, env::guest_t tls, env::guest_t child_tid) {
+	/* only threads of this process can be created */
+	if ((flags & consts::cloneThreadRequired) != consts::cloneThreadRequired || (flags & ~consts::cloneSupported) != 0) {
+		logger.warn(u8"Unsupported clone flags [", str::As{ U"#010x", flags }, u8"] used (only threads supported)");
+		return errCode::eNotImplemented;
+	}
+	if (pThreads.size() >= detail::MaxThreadCount)
+		return errCode::eAgain;
+	uint32_t tid = allocateId();
+
+	/* write the thread-id to the guest (address-space is shared between parent and child) */
+	env::Memory& mem = env::Instance()->memory();
+	if (detail::IsSet(flags, consts::cloneParentSetTid))
+		mem.write<uint32_t>(parent_tid, tid);
+	if (detail::IsSet(flags, consts::cloneChildSetTid))
+		mem.write<uint32_t>(child_tid, tid);
+
+	/* setup the new thread as copy of the current context, which resumes after the syscall */
+	Thread& thread = pThreads[tid];
+	thread.context = env::Instance()->context().save();
+	thread.pc = pUserspace->getPC();
+	thread.clearChildTid = (detail::IsSet(flags, consts::cloneChildClearTid) ? child_tid : 0);
+	thread.stack = stack;
+	thread.tls = tls;
+	thread.setTls = detail::IsSet(flags, consts::cloneSetTls);
+	thread.fresh = true;
+	sys::Writer::SetThreaded(true);
+	logger.debug(u8"Thread [", tid, u8"] created by [", pCurrent, u8']');
+	return tid;
+}
+int64_t sys::detail::Threads::exit(int32_t status, env::guest_t address) {
+	detail::ProcessConfig& config = pSyscall->process();
+	logger.debug(u8"Thread [", pCurrent, u8"] exited with [", status, u8']');
+
+	/* clear the child-tid and wake any joining threads (faults are silently ignored) */
+	if (config.clear_child_tid != 0) {
+		try {
+			env::Instance()->memory().write<uint32_t>(config.clear_child_tid, 0);
+			fWake(config.clear_child_tid, 1, consts::futexBitSetMatchAny);
+		}
+		catch (const env::MemoryFault&) {}
+	}
+
+	/* check if this was the last thread, in which case the process exits */
+	pThreads.erase(pCurrent);
+	sys::Writer::SetThreaded(pThreads.size() > 1);
+	if (pThreads.empty())
+		return pSyscall->processes().exit(status, address);
+
+	/* switch to the next thread (will not store the context of this thread anymore) */
+	pNext = fNextRunnable(true);
+	if (pNext == 0)
+		logger.fatal(u8"Deadlock detected as all remaining threads are blocked");
+	return errCode::eSuccess;
+}
+int64_t sys::detail::Threads::sched_yield() {
+	/* yielding never expires pending timeouts prematurely, as the current thread remains runnable */
+	pNext = fNextRunnable(false);
+	return errCode::eSuccess;
+}
+int64_t sys::detail::Threads::futex(env::guest_t uaddr, int64_t futex_op, uint32_t val, env::guest_t timeout, env::guest_t uaddr2, uint32_t val3) {
+	/* all futexes are considered private, as only a single process exists, and the clock-type is irrelevant */
+	futex_op &= ~(consts::futexFlagPrivateFlag | consts::futexFlagClockRealTime);
+
+	switch (futex_op) {
+	case consts::futexWait:
+		return fWait(uaddr, val, timeout, false, consts::futexBitSetMatchAny);
+	case consts::futexWaitBitSet:
+		return fWait(uaddr, val, timeout, true, val3);
+	case consts::futexWake:
+		return fWake(uaddr, val, consts::futexBitSetMatchAny);
+	case consts::futexWakeBitSet:
+		if (val3 == 0)
+			return errCode::eInvalid;
+		return fWake(uaddr, val, val3);
+	case consts::futexRequeue: {
+		/* timeout argument is interpreted as the number of waiters to requeue (only woken waiters are returned) */
+		uint32_t woken = fWake(uaddr, val, consts::futexBitSetMatchAny);
+		fRequeue(uaddr, uaddr2, timeout);
+		return woken;
+	}
+	case consts::futexCmpRequeue:
+		if (env::Instance()->memory().read<uint32_t>(uaddr) != val3)
+			return errCode::eAgain;
+		return int64_t(fWake(uaddr, val, consts::futexBitSetMatchAny)) + fRequeue(uaddr, uaddr2, timeout);
+	case consts::futexWakeOp:
+		return fWakeOp(uaddr, val, timeout, uaddr2, val3);
+	case consts::futexFd:
+		return errCode::eInvalid;
+	default:
+		logger.warn(u8"Unsupported futex operation [", futex_op, u8"] used");
+		return errCode::eNotImplemented;
+	}
+}
@@ -0,0 +1,113 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "../sys-common.h"
+
+namespace sys::detail {
+	static constexpr uint32_t MaxThreadCount = 64;
+
+	/* time after which a thread will be switched out at the next syscall */
+	static constexpr uint64_t ThreadSliceUS = 10'000;
+
+	namespace consts {
+		/* used by clone */
+		static constexpr uint64_t cloneSignalMask = 0x000000ff;
+		static constexpr uint64_t cloneVM = 0x00000100;
+		static constexpr uint64_t cloneFs = 0x00000200;
+		static constexpr uint64_t cloneFiles = 0x00000400;
+		static constexpr uint64_t cloneSigHand = 0x00000800;
+		static constexpr uint64_t cloneThread = 0x00010000;
+		static constexpr uint64_t cloneSysVSem = 0x00040000;
+		static constexpr uint64_t cloneSetTls = 0x00080000;
+		static constexpr uint64_t cloneParentSetTid = 0x00100000;
+		static constexpr uint64_t cloneChildClearTid = 0x00200000;
+		static constexpr uint64_t cloneChildSetTid = 0x01000000;
+		static constexpr uint64_t cloneThreadRequired = consts::cloneVM | consts::cloneFs | consts::cloneFiles | consts::cloneSigHand | consts::cloneThread;
+		static constexpr uint64_t cloneSupported = consts::cloneThreadRequired | consts::cloneSysVSem | consts::cloneSetTls
+			| consts::cloneParentSetTid | consts::cloneChildClearTid | consts::cloneChildSetTid | consts::cloneSignalMask;
+
+		/* used by futex */
+		static constexpr int64_t futexWait = 0;
+		static constexpr int64_t futexWake = 1;
+		static constexpr int64_t futexFd = 2;
+		static constexpr int64_t futexRequeue = 3;
+		static constexpr int64_t futexCmpRequeue = 4;
+		static constexpr int64_t futexWakeOp = 5;
+		static constexpr int64_t futexWaitBitSet = 9;
+		static constexpr int64_t futexWakeBitSet = 10;
+		static constexpr int64_t futexFlagPrivateFlag = 0x0080;
+		static constexpr int64_t futexFlagClockRealTime = 0x0100;
+		static constexpr uint32_t futexBitSetMatchAny = 0xffff'ffff;
+
+		/* used by futex wake-op */
+		static constexpr uint32_t futexOpSet = 0;
+		static constexpr uint32_t futexOpAdd = 1;
+		static constexpr uint32_t futexOpOr = 2;
+		static constexpr uint32_t futexOpAndNot = 3;
+		static constexpr uint32_t futexOpXor = 4;
+		static constexpr uint32_t futexOpArgShift = 8;
+		static constexpr uint32_t futexCmpEqual = 0;
+		static constexpr uint32_t futexCmpNotEqual = 1;
+		static constexpr uint32_t futexCmpLess = 2;
+		static constexpr uint32_t futexCmpLessEqual = 3;
+		static constexpr uint32_t futexCmpGreater = 4;
+		static constexpr uint32_t futexCmpGreaterEqual = 5;
+	}
+
+	/* cooperative scheduler of all guest-threads, which share the single address-space and
+	*	instance, and are only switched within syscalls (blocking futex, yield, exit, or after
+	*	the current time-slice has passed), which makes every guest instruction implicitly atomic
+	*	Note: timed futex-waits expire against the host-time, whenever the scheduler runs */
+	class Threads {
+	private:
+		struct Thread {
+			std::vector<uint8_t> context;
+			env::guest_t pc = 0;
+			env::guest_t clearChildTid = 0;
+			env::guest_t futex = 0;
+			env::guest_t stack = 0;
+			env::guest_t tls = 0;
+			uint64_t deadline = 0;
+			uint32_t bitset = 0;
+			bool waiting = false;
+			bool hasTimeout = false;
+			bool timedOut = false;
+			bool fresh = false;
+			bool setTls = false;
+		};
+
+	private:
+		std::map<uint32_t, Thread> pThreads;
+		detail::Syscall* pSyscall = 0;
+		sys::Userspace* pUserspace = 0;
+		uint64_t pSliceStart = 0;
+		uint32_t pCurrent = 0;
+		uint32_t pNext = 0;
+		uint32_t pLastTid = 0;
+
+	public:
+		Threads() = default;
+
+	private:
+		uint32_t fNextRunnable(bool expireTimeouts);
+		uint32_t fWake(env::guest_t uaddr, uint64_t count, uint32_t bitset);
+		uint32_t fRequeue(env::guest_t uaddr, env::guest_t uaddr2, uint64_t count);
+		int64_t fWait(env::guest_t uaddr, uint32_t val, env::guest_t timeout, bool absolute, uint32_t bitset);
+		int64_t fWakeOp(env::guest_t uaddr, uint32_t val, uint64_t val2, env::guest_t uaddr2, uint32_t val3);
+
+	public:
+		bool setup(detail::Syscall* syscall, sys::Userspace* userspace);
+		bool switchPending();
+		void switchThread();
+		size_t count() const;
+		uint32_t allocateId();
+		void restart();
+
+	public:
+		int64_t clone(uint64_t flags, env::guest_t stack, env::guest_t parent_tid, env::guest_t tls, env::guest_t child_tid);
+		int64_t exit(int32_t status, env::guest_t address);
+		int64_t sched_yield();
+		int64_t futex(env::guest_t uaddr, int64_t futex_op, uint32_t val, env::guest_t timeout, env::guest_t uaddr2, uint32_t val3);
+	};
+}
@@ -7,3 +7,4 @@
 #include "syscall/sys-syscall.h"
 #include "debugger/sys-debugger.h"
 #include "userspace/sys-userspace.h"
+#include "bench/sys-bench.h"
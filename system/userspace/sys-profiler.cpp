@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include "../system.h"
+
+static util::Logger logger{ u8"sys::profiler" };
+
+const elf::Symbol* sys::detail::Profiler::fSymbolize(env::guest_t address) const {
+	if (pImage == 0)
+		return 0;
+
+	/* lookup the closest symbol before the address (symbols without size are considered to extend to the next symbol) */
+	auto it = pImage->symbols.upper_bound(address);
+	if (it == pImage->symbols.begin())
+		return 0;
+	--it;
+	if (it->second.size > 0 && address - it->first >= it->second.size)
+		return 0;
+	return &it->second;
+}
+
+void sys::detail::Profiler::setup(bool sampling, bool perfMap) {
+	pSampling = sampling;
+	pPerfMap = perfMap;
+}
+bool sys::detail::Profiler::enabled() const {
+	return (pSampling || pPerfMap);
+}
+void sys::detail::Profiler::annotate(const std::vector<env::BlockExport>& exports) const {
+	if (!pPerfMap)
+		return;
+
+	/* pass the symbol and offset of each exported function to the host (unknown addresses are identified by the export-name already) */
+	for (const env::BlockExport& block : exports) {
+		const elf::Symbol* symbol = fSymbolize(block.address);
+		if (symbol == 0)
+			continue;
+		if (block.address == symbol->address)
+			host::PerfMapSymbol(block.name, symbol->name);
+		else
+			host::PerfMapSymbol(block.name, str::u8::Build(symbol->name, u8"+", str::As{ U"#x", block.address - symbol->address }));
+	}
+}
+void sys::detail::Profiler::addModule(std::u8string_view path, const uint8_t* data, size_t size, env::guest_t baseAddress) {
+	if (!enabled())
+		return;
+
+	/* read the symbols of the module (failure to read them only results in the samples being unknown) */
+	std::vector<elf::Symbol> symbols;
+	try {
+		symbols = sys::ReadElfSymbols(data, size, baseAddress);
+	}
+	catch (const elf::Exception& e) {
+		logger.warn(u8"Unable to read symbols of [", path, u8"]: ", e.what());
+		return;
+	}
+	logger.debug(u8"Read [", symbols.size(), u8"] symbols of [", path, u8']');
+
+	/* extend a copy of the current image, as the image might be shared with suspended processes */
+	std::shared_ptr<detail::ProfileImage> image = std::make_shared<detail::ProfileImage>();
+	if (pImage != 0)
+		*image = *pImage;
+	std::u8string_view name = util::SplitName(path).second;
+	for (elf::Symbol& symbol : symbols) {
+		symbol.name = str::u8::Build(name, u8';', symbol.name);
+		image->symbols.insert({ symbol.address, std::move(symbol) });
+	}
+	pImage = image;
+}
+void sys::detail::Profiler::collect() {
+	if (!pSampling)
+		return;
+
+	/* attribute all samples taken so far to the symbols of the current image */
+	for (const auto& [address, count] : gen::Instance()->takeSamples()) {
+		const elf::Symbol* symbol = fSymbolize(address);
+		pFolded[symbol == 0 ? u8"[unknown]" : symbol->name] += count;
+	}
+}
+std::shared_ptr<const sys::detail::ProfileImage> sys::detail::Profiler::image() const {
+	return pImage;
+}
+void sys::detail::Profiler::restoreImage(std::shared_ptr<const detail::ProfileImage> image) {
+	/* collect the samples of the previous image before its symbols are replaced */
+	collect();
+	pImage = image;
+}
+void sys::detail::Profiler::report() {
+	collect();
+	if (pFolded.empty())
+		return;
+
+	/* sort the stacks by their number of samples */
+	std::vector<std::pair<std::u8string_view, uint64_t>> stacks{ pFolded.begin(), pFolded.end() };
+	std::sort(stacks.begin(), stacks.end(), [](const auto& a, const auto& b) { return (a.second > b.second); });
+	uint64_t total = 0;
+	for (const auto& [stack, count] : stacks)
+		total += count;
+
+	/* write the folded stacks out (displayed no matter if logging is enabled or not, as it is the result of the profiling) */
+	host::PrintOutLn(str::u8::Build(u8"Profile of [", total, u8"] samples every [", gen::detail::SampleInterval, u8"] instructions (folded stacks):"));
+	for (const auto& [stack, count] : stacks)
+		host::PrintOutLn(str::u8::Build(stack, u8' ', count));
+}
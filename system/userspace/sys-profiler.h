@@ -0,0 +1,42 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "../sys-common.h"
+#include "../elf/sys-elf.h"
+
+namespace sys::detail {
+	/* function-symbols of the binary and interpreter of an image (names are prefixed by the name of their module) */
+	struct ProfileImage {
+		std::map<env::guest_t, elf::Symbol> symbols;
+	};
+
+	/* sampling profiler, which attributes the samples taken by the translated chunks to the function-symbols
+	*	of the image they were executed in (samples are collected whenever the image changes, as the addresses
+	*	might otherwise be attributed to the wrong symbols) and reports them as folded stacks [module;function count]
+	*	Note: can also pass the symbols of the exported functions of translated blocks to the host (for external profilers)
+	*	Note: only the binary and the interpreter are symbolized, all other addresses are attributed to [unknown] */
+	class Profiler {
+	private:
+		std::shared_ptr<const detail::ProfileImage> pImage;
+		std::map<std::u8string, uint64_t> pFolded;
+		bool pSampling = false;
+		bool pPerfMap = false;
+
+	public:
+		Profiler() = default;
+
+	private:
+		const elf::Symbol* fSymbolize(env::guest_t address) const;
+
+	public:
+		void setup(bool sampling, bool perfMap);
+		bool enabled() const;
+		void annotate(const std::vector<env::BlockExport>& exports) const;
+		void addModule(std::u8string_view path, const uint8_t* data, size_t size, env::guest_t baseAddress);
+		void collect();
+		std::shared_ptr<const detail::ProfileImage> image() const;
+		void restoreImage(std::shared_ptr<const detail::ProfileImage> image);
+		void report();
+	};
+}
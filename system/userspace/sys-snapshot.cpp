@@ -0,0 +1,274 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include "../system.h"
+
+static util::Logger logger{ u8"sys::snapshot" };
+
+void sys::detail::SnapshotWriter::u64(uint64_t value) {
+	bytes(&value, sizeof(value));
+}
+void sys::detail::SnapshotWriter::bytes(const void* data, size_t size) {
+	const uint8_t* ptr = static_cast<const uint8_t*>(data);
+	pData.insert(pData.end(), ptr, ptr + size);
+}
+void sys::detail::SnapshotWriter::buffer(const std::vector<uint8_t>& data) {
+	u64(data.size());
+	bytes(data.data(), data.size());
+}
+void sys::detail::SnapshotWriter::string(std::u8string_view value) {
+	u64(value.size());
+	bytes(value.data(), value.size());
+}
+std::vector<uint8_t>& sys::detail::SnapshotWriter::data() {
+	return pData;
+}
+
+sys::detail::SnapshotReader::SnapshotReader(const uint8_t* data, size_t size) : pData{ data }, pSize{ size } {}
+uint64_t sys::detail::SnapshotReader::u64() {
+	uint64_t value = 0;
+	bytes(&value, sizeof(value));
+	return value;
+}
+bool sys::detail::SnapshotReader::bytes(void* data, size_t size) {
+	if (pFailed || size > pSize - pOffset) {
+		pFailed = true;
+		return false;
+	}
+	std::copy(pData + pOffset, pData + pOffset + size, static_cast<uint8_t*>(data));
+	pOffset += size;
+	return true;
+}
+std::vector<uint8_t> sys::detail::SnapshotReader::buffer() {
+	uint64_t size = u64();
+	if (pFailed || size > pSize - pOffset) {
+		pFailed = true;
+		return {};
+	}
+	std::vector<uint8_t> out{ pData + pOffset, pData + pOffset + size };
+	pOffset += size;
+	return out;
+}
+std::u8string sys::detail::SnapshotReader::string() {
+	uint64_t size = u64();
+	if (pFailed || size > pSize - pOffset) {
+		pFailed = true;
+		return {};
+	}
+	std::u8string out{ reinterpret_cast<const char8_t*>(pData + pOffset), size_t(size) };
+	pOffset += size;
+	return out;
+}
+bool sys::detail::SnapshotReader::failed() const {
+	return pFailed;
+}
+bool sys::detail::SnapshotReader::completed() const {
+	return (!pFailed && pOffset == pSize);
+}
+
+std::vector<uint8_t> sys::detail::Snapshot::encode() const {
+	detail::SnapshotWriter out;
+
+	/* write the header and the configuration of the environment */
+	out.u64(detail::SnapshotMagic | (detail::SnapshotVersion << 56));
+	out.string(cpu);
+	out.u64(pageSize);
+	out.string(binary);
+	out.string(actual);
+	out.u64(args.size());
+	for (const std::u8string& arg : args)
+		out.string(arg);
+	out.u64(envs.size());
+	for (const std::u8string& env : envs)
+		out.string(env);
+
+	/* write the syscall-state */
+	out.string(process.username);
+	out.string(process.machine);
+	out.string(process.path);
+	out.string(process.workingDirectory);
+	out.u64(process.clear_child_tid);
+	out.u64(process.uid);
+	out.u64(process.gid);
+	out.u64(process.euid);
+	out.u64(process.egid);
+	out.u64(process.pid);
+	out.u64(process.pgid);
+	out.u64(process.tid);
+	out.u64(brk.init);
+	out.u64(brk.current);
+	out.u64(brk.aligned);
+
+	/* write the cpu-state */
+	out.u64(pc);
+	out.buffer(context);
+
+	/* write the memory-regions and their content */
+	out.u64(regions.size());
+	for (const detail::SnapshotRegion& region : regions) {
+		out.u64(region.address);
+		out.u64(region.size);
+		out.u64(region.usage);
+		out.buffer(region.data);
+	}
+
+	/* write the produced blocks */
+	out.u64(blockIdentity);
+	out.buffer(blocks);
+	return std::move(out.data());
+}
+std::optional<sys::detail::Snapshot> sys::detail::Snapshot::Decode(const uint8_t* data, size_t size) {
+	detail::SnapshotReader in{ data, size };
+	detail::Snapshot out;
+
+	/* validate the header */
+	if (in.u64() != (detail::SnapshotMagic | (detail::SnapshotVersion << 56))) {
+		logger.error(u8"Snapshot has an invalid header or an unsupported version");
+		return std::nullopt;
+	}
+
+	/* read the configuration of the environment */
+	out.cpu = in.string();
+	out.pageSize = in.u64();
+	out.binary = in.string();
+	out.actual = in.string();
+	for (uint64_t i = in.u64(); i > 0 && !in.failed(); --i)
+		out.args.push_back(in.string());
+	for (uint64_t i = in.u64(); i > 0 && !in.failed(); --i)
+		out.envs.push_back(in.string());
+
+	/* read the syscall-state */
+	out.process.username = in.string();
+	out.process.machine = in.string();
+	out.process.path = in.string();
+	out.process.workingDirectory = in.string();
+	out.process.clear_child_tid = in.u64();
+	out.process.uid = uint32_t(in.u64());
+	out.process.gid = uint32_t(in.u64());
+	out.process.euid = uint32_t(in.u64());
+	out.process.egid = uint32_t(in.u64());
+	out.process.pid = uint32_t(in.u64());
+	out.process.pgid = uint32_t(in.u64());
+	out.process.tid = uint32_t(in.u64());
+	out.brk.init = in.u64();
+	out.brk.current = in.u64();
+	out.brk.aligned = in.u64();
+
+	/* read the cpu-state */
+	out.pc = in.u64();
+	out.context = in.buffer();
+
+	/* read the memory-regions and their content */
+	for (uint64_t i = in.u64(); i > 0 && !in.failed(); --i) {
+		detail::SnapshotRegion& region = out.regions.emplace_back();
+		region.address = in.u64();
+		region.size = in.u64();
+		region.usage = uint32_t(in.u64());
+		region.data = in.buffer();
+		if (region.data.size() != region.size)
+			break;
+	}
+
+	/* read the produced blocks */
+	out.blockIdentity = in.u64();
+	out.blocks = in.buffer();
+
+	/* validate the consistency of the snapshot */
+	if (!in.completed() || (!out.regions.empty() && out.regions.back().data.size() != out.regions.back().size)) {
+		logger.error(u8"Snapshot is malformed or truncated");
+		return std::nullopt;
+	}
+	return out;
+}
+
+static bool RestoreContent(const std::vector<sys::detail::SnapshotRegion>& regions, bool sameLayout, std::vector<uint8_t>& buffer) {
+	env::Memory& mem = env::Instance()->memory();
+
+	/* write the content back (written without usage, as the regions might not be writable) */
+	for (const sys::detail::SnapshotRegion& region : regions) {
+		/* skip unchanged regions and remap changed executable regions to invalidate their translated blocks */
+		if (sameLayout) {
+			buffer.resize(region.size);
+			mem.mread(buffer.data(), region.address, region.size, env::Usage::None);
+			if (buffer == region.data)
+				continue;
+			if ((region.usage & env::Usage::Execute) != 0 && (!mem.munmap(region.address, region.size) || !mem.mmap(region.address, region.size, region.usage))) {
+				logger.error(u8"Failed to invalidate memory at [", str::As{ U"#018x", region.address }, u8"] with size [", str::As{ U"#010x", region.size }, u8']');
+				return false;
+			}
+		}
+		mem.mwrite(region.address, region.data.data(), region.size, env::Usage::None);
+	}
+	return true;
+}
+static bool MatchesContent(const std::vector<sys::detail::SnapshotRegion>& regions, std::vector<uint8_t>& buffer) {
+	env::Memory& mem = env::Instance()->memory();
+	for (const sys::detail::SnapshotRegion& region : regions) {
+		buffer.resize(region.size);
+		mem.mread(buffer.data(), region.address, region.size, env::Usage::None);
+		if (buffer != region.data)
+			return false;
+	}
+	return true;
+}
+
+std::vector<sys::detail::SnapshotRegion> sys::detail::Snapshot::CaptureMemory() {
+	env::Memory& mem = env::Instance()->memory();
+	std::vector<detail::SnapshotRegion> out;
+
+	/* iterate over all mapped regions and read their content without checking their usage */
+	for (auto [address, size] = mem.findNext(0); size > 0 && address < detail::ForkStashAddress; std::tie(address, size) = mem.findNext(address + size)) {
+		detail::SnapshotRegion& region = out.emplace_back();
+		region.address = address;
+		region.size = size;
+		region.usage = mem.getUsage(address);
+		region.data.resize(size);
+		mem.mread(region.data.data(), address, size, env::Usage::None);
+	}
+	return out;
+}
+bool sys::detail::Snapshot::RestoreMemory(const std::vector<detail::SnapshotRegion>& regions) {
+	env::Memory& mem = env::Instance()->memory();
+
+	/* check if the current layout of the memory matches the regions, in which case only the content needs to be replaced */
+	bool sameLayout = true;
+	size_t count = 0;
+	for (auto [address, size] = mem.findNext(0); size > 0 && address < detail::ForkStashAddress && sameLayout; std::tie(address, size) = mem.findNext(address + size)) {
+		sameLayout = (count < regions.size() && regions[count].address == address && regions[count].size == size && regions[count].usage == mem.getUsage(address));
+		++count;
+	}
+	if (count != regions.size())
+		sameLayout = false;
+
+	/* write the content back into the current layout, and check if shared physical memory caused writes of one region
+	*	to affect other regions (i.e. the sharing differs from the captured state), in which case the layout is rebuilt */
+	std::vector<uint8_t> buffer;
+	if (sameLayout) {
+		if (!RestoreContent(regions, true, buffer))
+			return false;
+		if (mem.totalShared() == 0 || MatchesContent(regions, buffer))
+			return true;
+		logger.debug(u8"Shared memory differs from the captured state, rebuilding the memory layout");
+	}
+
+	/* setup the new layout (will invalidate all translated blocks, if executable regions are removed) */
+	detail::Snapshot::ClearMemory();
+	for (const detail::SnapshotRegion& region : regions) {
+		if (mem.mmap(region.address, region.size, region.usage))
+			continue;
+		logger.error(u8"Failed to restore memory at [", str::As{ U"#018x", region.address }, u8"] with size [", str::As{ U"#010x", region.size }, u8']');
+		return false;
+	}
+	return RestoreContent(regions, false, buffer);
+}
+void sys::detail::Snapshot::ClearMemory() {
+	env::Memory& mem = env::Instance()->memory();
+
+	/* collect the regions first, as unmapping them might merge/split the remaining regions */
+	std::vector<std::pair<env::guest_t, uint64_t>> regions;
+	for (auto [address, size] = mem.findNext(0); size > 0 && address < detail::ForkStashAddress; std::tie(address, size) = mem.findNext(address + size))
+		regions.push_back({ address, size });
+	for (const auto& [address, size] : regions) {
+		if (!mem.munmap(address, size))
+			logger.warn(u8"Failed to release memory at [", str::As{ U"#018x", address }, u8"] with size [", str::As{ U"#010x", size }, u8']');
+	}
+}
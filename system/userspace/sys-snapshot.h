@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "../sys-common.h"
+#include "../syscall/sys-syscall.h"
+
+namespace sys::detail {
+	/* magic is 'wlsnap' followed by the version */
+	static constexpr uint64_t SnapshotMagic = 0x0000'7061'6e73'6c77;
+	static constexpr uint64_t SnapshotVersion = 1;
+
+	/* custom result of the checkpoint-syscall, when the process has been resumed from the snapshot */
+	static constexpr int64_t SnapshotResumed = 1;
+
+	/* flat byte-stream used to serialize the snapshot (values are stored in host byte-order) */
+	class SnapshotWriter {
+	private:
+		std::vector<uint8_t> pData;
+
+	public:
+		SnapshotWriter() = default;
+
+	public:
+		void u64(uint64_t value);
+		void bytes(const void* data, size_t size);
+		void buffer(const std::vector<uint8_t>& data);
+		void string(std::u8string_view value);
+		std::vector<uint8_t>& data();
+	};
+
+	/* reader of the flat byte-stream (reading past the end will mark the reader as failed and return empty values) */
+	class SnapshotReader {
+	private:
+		const uint8_t* pData = 0;
+		size_t pSize = 0;
+		size_t pOffset = 0;
+		bool pFailed = false;
+
+	public:
+		SnapshotReader(const uint8_t* data, size_t size);
+
+	public:
+		uint64_t u64();
+		bool bytes(void* data, size_t size);
+		std::vector<uint8_t> buffer();
+		std::u8string string();
+		bool failed() const;
+		bool completed() const;
+	};
+
+	struct SnapshotRegion {
+		std::vector<uint8_t> data;
+		env::guest_t address = 0;
+		uint64_t size = 0;
+		uint32_t usage = 0;
+	};
+
+	/* complete state of a single-threaded process at a syscall-boundary, which is sufficient to resume it
+	*	in a fresh environment (produced blocks are only hints and will be validated before being reused) */
+	struct Snapshot {
+		std::vector<std::u8string> args;
+		std::vector<std::u8string> envs;
+		std::vector<detail::SnapshotRegion> regions;
+		std::vector<uint8_t> context;
+		std::vector<uint8_t> blocks;
+		std::u8string cpu;
+		std::u8string binary;
+		std::u8string actual;
+		detail::ProcessConfig process;
+		detail::BreakState brk;
+		env::guest_t pc = 0;
+		uint64_t pageSize = 0;
+		uint64_t blockIdentity = 0;
+
+	public:
+		std::vector<uint8_t> encode() const;
+		static std::optional<detail::Snapshot> Decode(const uint8_t* data, size_t size);
+
+	public:
+		/* capture all memory-regions of the process and their content (shared physical memory will be captured as separate copies, stashed memory of suspended processes is ignored) */
+		static std::vector<detail::SnapshotRegion> CaptureMemory();
+
+		/* replace the memory with the regions (unchanged regions are kept to preserve their translated blocks, also while physical memory is shared) */
+		static bool RestoreMemory(const std::vector<detail::SnapshotRegion>& regions);
+
+		/* release all memory-regions of the process (stashed memory of suspended processes is kept) */
+		static void ClearMemory();
+	};
+}
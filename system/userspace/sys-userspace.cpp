@@ -9,15 +9,21 @@ bool sys::Userspace::fSetup(std::unique_ptr<sys::Userspace>&& system, std::uniqu
 	pArgs = config.args;
 	pEnvs = config.envs;
 	pBinaryPath = config.binary;
+	pCheckpoint = config.checkpoint;
+	pRestore = config.restore;
 	pCpu = cpu.get();
+	pProfiler.setup(config.trace == gen::TraceType::profile, host::PerfMapEnabled());
 
 	/* log the configuration */
 	logger.info(u8"  Cpu              : [", pCpu->name(), u8']');
 	logger.info(u8"  Debug            : ", str::As{ U"S", debug });
 	logger.info(u8"  Log Blocks       : ", str::As{ U"S", config.logBlocks });
 	logger.info(u8"  Trace Blocks     : ", config.trace);
+	logger.info(u8"  Perf Map         : ", str::As{ U"S", host::PerfMapEnabled() });
 	logger.info(u8"  Translation Depth: ", config.translationDepth);
 	logger.info(u8"  Binary           : ", pBinaryPath);
+	logger.info(u8"  Checkpoint       : ", (pCheckpoint.empty() ? u8"none" : pCheckpoint));
+	logger.info(u8"  Restore          : ", (pRestore.empty() ? u8"none" : pRestore));
 	logger.info(u8"  Arguments        : ", pArgs.size());
 	for (size_t i = 0; i < pArgs.size(); ++i)
 		logger.info(u8"               [", str::As{ U" 2", i }, u8"]: ", pArgs[i]);
@@ -71,6 +77,16 @@ std::u8string_view sys::Userspace::fArchType(sys::ArchType architecture) const {
 		return u8"unknown";
 	}
 }
+sys::ArchType sys::Userspace::fMachineArch(elf::MachineType machine) const {
+	switch (machine) {
+	case elf::MachineType::riscv:
+		return sys::ArchType::riscv64;
+	case elf::MachineType::x86_64:
+		return sys::ArchType::x86_64;
+	default:
+		return sys::ArchType::unknown;
+	}
+}
 env::guest_t sys::Userspace::fPrepareStack() const {
 	env::Memory& mem = env::Instance()->memory();
 	size_t wordWidth = ((pLoaded.bitWidth == 64) ? 8 : 4);
@@ -243,28 +259,60 @@ void sys::Userspace::fStartLoad(const std::u8string& path) {
 			return;
 		}
 
-		/* allocate the buffer for the file-content and read it into memory */
-		uint8_t* buffer = new uint8_t[stats->size];
-		env::Instance()->filesystem().readFile(stats->id, 0, buffer, stats->size, [this, size = stats->size, actual, buffer](std::optional<uint64_t> read) {
-			std::unique_ptr<uint8_t[]> _cleanup{ buffer };
-
-			/* check if the size still matches */
-			if (size != read) {
-				/* this error should be displayed to the user, no matter if logging is enabled or not */
-				std::u8string_view msg = (read.has_value() ? u8"Unable to read entire file" : u8"Error while reading file");
-				if (!logger.error(msg))
-					host::PrintOutLn(msg);
+		/* check if the unmodified file has already been loaded by a previous process (copied, as the cache might change during the loading) */
+		if (const std::vector<uint8_t>* warm = detail::WarmCache::LookupFile(actual, *stats); warm != 0) {
+			std::vector<uint8_t> data = *warm;
+			if (!fBinaryLoaded(actual, data.data(), data.size(), std::nullopt))
 				env::Instance()->shutdown();
+			return;
+		}
+
+		/* check if the segments can be populated lazily from the file, in which case only the headers need to be read up
+		*	front (requires the file-tasks to be completed in-place, as the population of the pages cannot be deferred) */
+		fReadBinary(actual, *stats, env::Instance()->filesystem().completesInplace() && !pProfiler.enabled());
+		});
+}
+void sys::Userspace::fReadBinary(const std::u8string& actual, const env::FileStats& stats, bool lazy) {
+	/* allocate the buffer for the file-content (or only its leading headers) and read it into memory */
+	uint64_t size = (lazy ? std::min<uint64_t>(stats.size, detail::LazyHeaderSize) : stats.size);
+	uint8_t* buffer = new uint8_t[size];
+	env::Instance()->filesystem().readFile(stats.id, 0, buffer, size, [this, size, stats, actual, buffer, lazy](std::optional<uint64_t> read) {
+		std::unique_ptr<uint8_t[]> _cleanup{ buffer };
+
+		/* check if the size still matches */
+		if (size != read) {
+			/* this error should be displayed to the user, no matter if logging is enabled or not */
+			std::u8string_view msg = (read.has_value() ? u8"Unable to read entire file" : u8"Error while reading file");
+			if (!logger.error(msg))
+				host::PrintOutLn(msg);
+			env::Instance()->shutdown();
+			return;
+		}
+
+		/* check if only the headers have been read, in which case the remainder is populated lazily (fall back to reading the entire
+		*	file, if the headers are not fully contained, which will also produce the proper error message for malformed files) */
+		if (size < stats.size) {
+			try {
+				sys::ProbeElf(buffer, size);
+			}
+			catch (const elf::Exception& e) {
+				logger.debug(u8"Lazy loading of [", actual, u8"] not possible: ", e.what());
+				fReadBinary(actual, stats, false);
 				return;
 			}
-
-			/* perform the actual loading of the file */
-			if (!fBinaryLoaded(actual, buffer, size))
+			logger.debug(u8"Populating [", actual, u8"] lazily from the file");
+			if (!fBinaryLoaded(actual, buffer, size, elf::FileBacking{ stats.id, stats.size }))
 				env::Instance()->shutdown();
-			});
+			return;
+		}
+
+		/* register the file for subsequent processes and perform the actual loading of the file */
+		detail::WarmCache::StoreFile(actual, stats, buffer, size);
+		if (!fBinaryLoaded(actual, buffer, size, std::nullopt))
+			env::Instance()->shutdown();
 		});
 }
-bool sys::Userspace::fBinaryLoaded(const std::u8string& actual, const uint8_t* data, size_t size) {
+bool sys::Userspace::fBinaryLoaded(const std::u8string& actual, const uint8_t* data, size_t size, std::optional<elf::FileBacking> backing) {
 	/* log the successful load and write the path back */
 	if (pLoaded.interpreter.empty()) {
 		pBinaryActual = actual;
@@ -277,13 +325,15 @@ bool sys::Userspace::fBinaryLoaded(const std::u8string& actual, const uint8_t* d
 	try {
 		/* check if just the interpreter needs to be loaded (no need to perform architecture checks again - as it will remain unchanged) */
 		if (!pLoaded.interpreter.empty()) {
-			sys::LoadElfInterpreter(pLoaded, data, size);
+			sys::LoadElfInterpreter(pLoaded, data, size, backing);
+			pProfiler.addModule(actual, data, size, pLoaded.aux.base);
 			logger.debug(u8"Entry of interpreter: ", str::As{ U"#018x", pLoaded.start });
 			return fLoadCompleted();
 		}
 
 		/* load the elf */
-		pLoaded = sys::LoadElf(data, size);
+		pLoaded = sys::LoadElf(data, size, backing);
+		pProfiler.addModule(actual, data, size, pLoaded.base);
 		logger.debug(u8"Entry of program   : ", str::As{ U"#018x", pLoaded.start });
 		logger.debug(u8"Start of heap      : ", str::As{ U"#018x", pLoaded.endOfData });
 	}
@@ -305,21 +355,8 @@ bool sys::Userspace::fBinaryLoaded(const std::u8string& actual, const uint8_t* d
 		return false;
 	}
 
-	/* validate the machine type and match it */
-	sys::ArchType arch = sys::ArchType::unknown;
-	switch (pLoaded.machine) {
-	case elf::MachineType::riscv:
-		arch = sys::ArchType::riscv64;
-		break;
-	case elf::MachineType::x86_64:
-		arch = sys::ArchType::x86_64;
-		break;
-	default:
-		arch = sys::ArchType::unknown;
-		break;
-	}
-
-	/* check if the type matches */
+	/* validate the machine type and check if the type matches */
+	sys::ArchType arch = fMachineArch(pLoaded.machine);
 	if (pCpu->architecture() != arch) {
 		/* this error should be displayed to the user, no matter if logging is enabled or not */
 		std::u8string msg = str::u8::Build(u8"Cpu for architecture [", fArchType(pCpu->architecture()), u8"] cannot execute elf of type [", fArchType(arch), u8']');
@@ -363,61 +400,333 @@ bool sys::Userspace::fLoadCompleted() {
 	return true;
 }
 
-void sys::Userspace::fCheckContinue() const {
-	/* check if the memory detected an invalidation */
-	env::Instance()->memory().checkXInvalidated(pAddress);
+uint64_t sys::Userspace::fWarmIdentity() const {
+	/* blocks can only be reused, if the environment, the generator configuration, and the embedded
+	*	writer-state match (blocks of snapshots might have been produced by another host process) */
+	uint64_t identity = env::Instance()->blockIdentity();
+	identity = (identity * 31) + uint64_t(sys::Writer::StateAddress());
+	identity = (identity * 31) + gen::Instance()->translationDepth();
+	identity = (identity * 31) + uint64_t(gen::Instance()->trace());
+	identity = (identity * 31) + (gen::Instance()->debugCheck() ? 1 : 0);
+	return identity;
 }
-void sys::Userspace::fExecute() {
-	/* start execution of the next address and catch/handle any incoming exceptions */
-	try {
-		/* check if the execution can simply continue and execute the next address */
-		fCheckContinue();
-		env::Instance()->mapping().execute(pAddress);
-	}
-	catch (const env::Terminated& e) {
-		pAddress = e.address;
-		logger.log(u8"Execution terminated at [", str::As{ U"#018x", e.address }, u8"] with [", e.code, u8']');
 
-		/* shutdown the system */
-		logger.log(u8"Shutting userspace environment down");
-		env::Instance()->shutdown();
+void sys::Userspace::fStartRestore() {
+	std::u8string actual = util::CanonicalPath(pRestore);
+
+	/* load the snapshot */
+	env::Instance()->filesystem().readStats(actual, [this, actual](const env::FileStats* stats) {
+		/* check if the snapshot exists (error should be displayed to the user, no matter if logging is enabled or not) */
+		if (stats == 0 || stats->type != env::FileType::file) {
+			std::u8string msg = str::u8::Build(u8"Snapshot [", actual, u8"] does not exist or is not a file");
+			if (!logger.error(msg))
+				host::PrintOutLn(msg);
+			env::Instance()->shutdown();
+			return;
+		}
+
+		/* allocate the buffer for the snapshot and read it into memory */
+		uint8_t* buffer = new uint8_t[stats->size];
+		env::Instance()->filesystem().readFile(stats->id, 0, buffer, stats->size, [this, size = stats->size, buffer](std::optional<uint64_t> read) {
+			std::unique_ptr<uint8_t[]> _cleanup{ buffer };
+
+			/* check if the size still matches */
+			if (size != read) {
+				std::u8string_view msg = (read.has_value() ? u8"Unable to read entire snapshot" : u8"Error while reading snapshot");
+				if (!logger.error(msg))
+					host::PrintOutLn(msg);
+				env::Instance()->shutdown();
+				return;
+			}
+
+			/* perform the actual restoring of the process */
+			if (!fSnapshotLoaded(buffer, size))
+				env::Instance()->shutdown();
+			});
+		});
+}
+bool sys::Userspace::fSnapshotLoaded(const uint8_t* data, size_t size) {
+	std::optional<detail::Snapshot> snapshot = detail::Snapshot::Decode(data, size);
+	if (!snapshot.has_value())
+		return false;
+
+	/* validate that the snapshot was produced by the same environment and command (error should be displayed to the user) */
+	std::u8string_view error;
+	if (snapshot->cpu != pCpu->name() || snapshot->context.size() != pCpu->contextSize() || snapshot->pageSize != env::Instance()->pageSize())
+		error = u8"Snapshot was produced for a different cpu configuration";
+	else if (snapshot->binary != pBinaryPath || snapshot->args != pArgs || snapshot->envs != pEnvs)
+		error = u8"Snapshot was produced for a different binary, arguments, or environment";
+	if (!error.empty()) {
+		if (!logger.error(error))
+			host::PrintOutLn(error);
+		return false;
 	}
-	catch (const env::MemoryFault& e) {
-		pAddress = e.address;
-		logger.fmtFatal(u8"MemoryFault detected at: [{:#018x}] while accessing [{:#018x}] as [{}] while page is mapped as [{}]",
-			e.address, e.accessed, env::Usage::Print{ e.usedUsage }, env::Usage::Print{ e.actualUsage });
+	pBinaryActual = snapshot->actual;
+
+	/* restore the memory-regions */
+	if (!detail::Snapshot::RestoreMemory(snapshot->regions))
+		return false;
+
+	/* initialize the syscall environment and restore its state */
+	if (!pSyscall.setup(this, snapshot->brk.init, pBinaryActual, fArchType(pCpu->architecture()))) {
+		logger.error(u8"Failed to setup the userspace syscalls");
+		return false;
 	}
-	catch (const env::Decoding& e) {
-		pAddress = e.address;
-		logger.fatal(u8"Decoding caught: [", str::As{ U"#018x", e.address }, u8"] - [", (e.memoryFault ? u8"Memory-Fault" : u8"Decoding-Fault"), u8']');
+	pSyscall.process() = snapshot->process;
+	pSyscall.memory().restoreBreak(snapshot->brk);
+
+	/* restore the context, which resumes after the checkpoint-syscall with the result marking it as resumed */
+	env::Instance()->context().restore(snapshot->context);
+	pAddress = snapshot->pc;
+	pCpu->syscallSetResult(detail::SnapshotResumed);
+
+	/* register the previously produced blocks (validated before being used) */
+	if (!env::Instance()->logBlocks() && snapshot->blockIdentity == fWarmIdentity()) {
+		if (!detail::WarmCache::ImportBlocks(snapshot->blockIdentity, snapshot->blocks))
+			logger.warn(u8"Failed to import the produced blocks of the snapshot");
 	}
-	catch (const env::Translate& e) {
-		pAddress = e.address;
-		logger.debug(u8"Translate caught: [", str::As{ U"#018x", e.address }, u8']');
-		env::Instance()->startNewBlock();
+
+	/* log the system as fully restored */
+	logger.log(u8"Userspace environment restored from snapshot [", pRestore, u8"] at [", str::As{ U"#018x", pAddress }, u8']');
+
+	/* startup the translation and execution of the blocks */
+	env::Instance()->startNewBlock();
+	return true;
+}
+int64_t sys::Userspace::fWriteSnapshot(uint64_t id, std::shared_ptr<std::vector<uint8_t>> data) {
+	pSyscall.files().dentries().dropNode(id);
+
+	/* resize the file to the snapshot (writing will not resize the file) */
+	env::Instance()->filesystem().resizeFile(id, data->size(), [this, id, data](bool success) {
+		pSyscall.callContinue([this, id, data, success]() -> int64_t {
+			if (!success)
+				return errCode::eIO;
+
+			/* write the snapshot to the file */
+			env::Instance()->filesystem().writeFile(id, 0, data->data(), data->size(), [this, data](std::optional<uint64_t> written) {
+				pSyscall.callContinue([this, data, written]() -> int64_t {
+					if (written != data->size())
+						return errCode::eIO;
+					logger.log(u8"Snapshot of [", data->size(), u8"] bytes written to [", pCheckpoint, u8']');
+					return errCode::eSuccess;
+					});
+				});
+			return pSyscall.callIncomplete();
+			});
+		});
+
+	/* potentially defer the call */
+	return pSyscall.callIncomplete();
+}
+
+int64_t sys::Userspace::fExecRead(const std::u8string& path, size_t links, std::function<int64_t(int64_t, const std::u8string&, const std::vector<uint8_t>&)> callback) {
+	env::Instance()->filesystem().readStats(path, [this, path, links, callback](const env::FileStats* stats) {
+		pSyscall.callContinue([this, path, links, callback, stats]() -> int64_t {
+			if (stats == 0)
+				return callback(errCode::eNoEntry, path, {});
+
+			/* follow symbolic links (relative to the directory containing the link) */
+			if (stats->type == env::FileType::link) {
+				if (links >= detail::MaxFollowSymLinks)
+					return callback(errCode::eLoop, path, {});
+				return fExecRead(util::MergePaths(util::SplitName(path).first, stats->link), links + 1, callback);
+			}
+			if (stats->type != env::FileType::file)
+				return callback(errCode::eAccess, path, {});
+
+			/* check if the unmodified file has already been loaded by a previous process (copied, as the cache might change during the loading) */
+			if (const std::vector<uint8_t>* warm = detail::WarmCache::LookupFile(path, *stats); warm != 0) {
+				std::vector<uint8_t> data = *warm;
+				return callback(errCode::eSuccess, path, data);
+			}
+
+			/* read the file into memory */
+			std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>(stats->size);
+			env::Instance()->filesystem().readFile(stats->id, 0, data->data(), data->size(), [this, path, callback, stats = *stats, data](std::optional<uint64_t> read) {
+				pSyscall.callContinue([this, path, callback, stats, data, read]() -> int64_t {
+					if (read != data->size())
+						return callback(errCode::eIO, path, {});
+
+					/* register the file for subsequent processes */
+					detail::WarmCache::StoreFile(path, stats, data->data(), data->size());
+					return callback(errCode::eSuccess, path, *data);
+					});
+				});
+			return pSyscall.callIncomplete();
+			});
+		});
+
+	/* potentially defer the call */
+	return pSyscall.callIncomplete();
+}
+int64_t sys::Userspace::fExecLoaded(std::shared_ptr<detail::ImageConfig> image, const std::u8string& actual, const std::vector<uint8_t>& data, size_t redirects) {
+	/* check if the file is a script, in which case its interpreter is executed with the script as argument */
+	if (data.size() >= 2 && data[0] == u8'#' && data[1] == u8'!') {
+		if (redirects >= detail::MaxExecuteRedirects)
+			return errCode::eLoop;
+
+		/* extract the interpreter and its optional single argument from the first line */
+		size_t end = std::find(data.begin() + 2, data.end(), u8'\n') - data.begin();
+		std::u8string line{ data.begin() + 2, data.begin() + end };
+		size_t begin = line.find_first_not_of(u8" \t\r");
+		if (begin == std::u8string::npos)
+			return errCode::eNoExec;
+		line = line.substr(begin, line.find_last_not_of(u8" \t\r") + 1 - begin);
+		size_t split = line.find_first_of(u8" \t");
+		std::u8string interpreter = line.substr(0, split);
+		std::u8string argument = (split == std::u8string::npos ? u8"" : line.substr(line.find_first_not_of(u8" \t", split)));
+
+		/* replace the binary with the interpreter and pass the script-path on (the original first argument is dropped) */
+		std::vector<std::u8string> args;
+		if (!argument.empty())
+			args.push_back(argument);
+		args.push_back(image->actual);
+		args.insert(args.end(), image->args.begin(), image->args.end());
+		image->args = std::move(args);
+		image->binary = interpreter;
+		image->actual = util::MergePaths(pSyscall.process().workingDirectory, interpreter);
+		logger.debug(u8"Executing script [", actual, u8"] through [", interpreter, u8']');
+
+		return fExecRead(image->actual, 0, [this, image, redirects](int64_t result, const std::u8string& actual, const std::vector<uint8_t>& data) -> int64_t {
+			if (result != errCode::eSuccess)
+				return result;
+			return fExecLoaded(image, actual, data, redirects + 1);
+			});
 	}
-	catch (const env::ExecuteDirty& e) {
-		pAddress = e.address;
-		logger.debug(u8"Flushing instruction cache");
-		env::Instance()->mapping().flush();
-		env::Instance()->startNewBlock();
+
+	/* validate the elf-file before the current image is discarded */
+	elf::LoadState probed;
+	try {
+		probed = sys::ProbeElf(data.data(), data.size());
 	}
-	catch (const detail::CpuException& e) {
-		pAddress = e.address;
-		logger.fatal(u8"CPU Exception caught: [", str::As{ U"#018x", e.address }, u8"] - [", pCpu->getExceptionText(e.id), u8']');
+	catch (const elf::Exception& e) {
+		logger.warn(u8"Executable [", actual, u8"] rejected: ", e.what());
+		return errCode::eNoExec;
 	}
-	catch (const detail::UnknownSyscall& e) {
-		pAddress = e.address;
-		logger.fatal(u8"Unknown syscall caught: [", str::As{ U"#018x", e.address }, u8"] - [Index: ", e.index, u8']');
+	if (probed.bitWidth != 64 || fMachineArch(probed.machine) != pCpu->architecture()) {
+		logger.warn(u8"Executable [", actual, u8"] cannot be executed by cpu for architecture [", fArchType(pCpu->architecture()), u8']');
+		return errCode::eNoExec;
 	}
-	catch (const detail::AwaitingSyscall&) {
-		logger.trace(u8"Awaiting syscall result at [", str::As{ U"#018x", pAddress }, u8']');
+
+	/* check if an interpreter needs to be loaded as well */
+	if (probed.interpreter.empty())
+		return fExecCommit(*image, actual, data, {});
+	std::shared_ptr<std::vector<uint8_t>> binary = std::make_shared<std::vector<uint8_t>>(data);
+	return fExecRead(util::CanonicalPath(probed.interpreter), 0, [this, image, actual, binary](int64_t result, const std::u8string& path, const std::vector<uint8_t>& interpreter) -> int64_t {
+		if (result != errCode::eSuccess)
+			return result;
+
+		/* validate the interpreter as well, as any failures after discarding the current image are fatal */
+		try {
+			elf::LoadState probed = sys::ProbeElf(interpreter.data(), interpreter.size());
+			if (probed.bitWidth != 64 || fMachineArch(probed.machine) != pCpu->architecture() || !probed.interpreter.empty())
+				return errCode::eNoExec;
+		}
+		catch (const elf::Exception& e) {
+			logger.warn(u8"Interpreter [", path, u8"] rejected: ", e.what());
+			return errCode::eNoExec;
+		}
+		return fExecCommit(*image, actual, *binary, interpreter);
+		});
+}
+int64_t sys::Userspace::fExecCommit(const detail::ImageConfig& image, const std::u8string& actual, const std::vector<uint8_t>& binary, const std::vector<uint8_t>& interpreter) {
+	logger.debug(u8"Executing [", actual, u8"] as [", image.binary, u8']');
+
+	/* discard the current image (point of no return, all failures from here on are fatal) */
+	detail::Snapshot::ClearMemory();
+	restoreImage(image);
+	pBinaryActual = actual;
+
+	/* load the new elf-image */
+	try {
+		pLoaded = sys::LoadElf(binary.data(), binary.size(), std::nullopt);
+		pProfiler.addModule(actual, binary.data(), binary.size(), pLoaded.base);
+		if (!interpreter.empty()) {
+			sys::LoadElfInterpreter(pLoaded, interpreter.data(), interpreter.size(), std::nullopt);
+			pProfiler.addModule(pLoaded.interpreter, interpreter.data(), interpreter.size(), pLoaded.aux.base);
+		}
 	}
-	catch (const detail::DebuggerHalt&) {
-		logger.trace(u8"Debugger halted at [", str::As{ U"#018x", pAddress }, u8']');
+	catch (const elf::Exception& e) {
+		logger.fatal(u8"Error while loading elf: ", e.what());
 	}
+	pAddress = pLoaded.start;
 
-	/* will onlybe reached through: New block being generated, DebuggerHalt, AwaitingSyscall */
+	/* setup the new stack and the cleared context */
+	env::guest_t spAddress = fPrepareStack();
+	env::Instance()->context().restore(std::vector<uint8_t>(pCpu->contextSize(), 0));
+	if (spAddress == 0 || !pCpu->setupContext(pAddress, spAddress))
+		logger.fatal(u8"Failed to setup the context for [", actual, u8']');
+
+	/* notify the syscalls about the new image (will unwind the execution of the previous image) */
+	pSyscall.processes().executed(pLoaded.endOfData, pBinaryActual);
+	return errCode::eSuccess;
+}
+
+void sys::Userspace::fCheckContinue() const {
+	/* check if the memory detected an invalidation */
+	env::Instance()->memory().checkXInvalidated(pAddress);
+}
+void sys::Userspace::fExecute() {
+	/* loop to restart the execution whenever another thread has been switched in */
+	bool restart = true;
+	while (restart) {
+		restart = false;
+
+		/* start execution of the next address and catch/handle any incoming exceptions */
+		try {
+			/* check if the execution can simply continue and execute the next address */
+			fCheckContinue();
+			env::Instance()->mapping().execute(pAddress);
+		}
+		catch (const env::Terminated& e) {
+			pAddress = e.address;
+			logger.log(u8"Execution terminated at [", str::As{ U"#018x", e.address }, u8"] with [", e.code, u8']');
+
+			/* shutdown the system */
+			logger.log(u8"Shutting userspace environment down");
+			env::Instance()->shutdown();
+		}
+		catch (const env::MemoryFault& e) {
+			pAddress = e.address;
+			logger.fmtFatal(u8"MemoryFault detected at: [{:#018x}] while accessing [{:#018x}] as [{}] while page is mapped as [{}]",
+				e.address, e.accessed, env::Usage::Print{ e.usedUsage }, env::Usage::Print{ e.actualUsage });
+		}
+		catch (const env::Decoding& e) {
+			pAddress = e.address;
+			logger.fatal(u8"Decoding caught: [", str::As{ U"#018x", e.address }, u8"] - [", (e.memoryFault ? u8"Memory-Fault" : u8"Decoding-Fault"), u8']');
+		}
+		catch (const env::Translate& e) {
+			pAddress = e.address;
+			logger.debug(u8"Translate caught: [", str::As{ U"#018x", e.address }, u8']');
+			env::Instance()->startNewBlock();
+		}
+		catch (const env::ExecuteDirty& e) {
+			pAddress = e.address;
+			logger.debug(u8"Flushing instruction cache");
+			env::Instance()->mapping().flush();
+			env::Instance()->startNewBlock();
+		}
+		catch (const detail::CpuException& e) {
+			pAddress = e.address;
+			logger.fatal(u8"CPU Exception caught: [", str::As{ U"#018x", e.address }, u8"] - [", pCpu->getExceptionText(e.id), u8']');
+		}
+		catch (const detail::UnknownSyscall& e) {
+			pAddress = e.address;
+			logger.fatal(u8"Unknown syscall caught: [", str::As{ U"#018x", e.address }, u8"] - [Index: ", e.index, u8']');
+		}
+		catch (const detail::ThreadSwitch&) {
+			logger.trace(u8"Thread switched to [", str::As{ U"#018x", pAddress }, u8']');
+			restart = true;
+		}
+		catch (const detail::AwaitingSyscall&) {
+			logger.trace(u8"Awaiting syscall result at [", str::As{ U"#018x", pAddress }, u8']');
+		}
+		catch (const detail::DebuggerHalt&) {
+			logger.trace(u8"Debugger halted at [", str::As{ U"#018x", pAddress }, u8']');
+		}
+
+		/* will onlybe reached through: New block being generated, DebuggerHalt, AwaitingSyscall (or loop on ThreadSwitch) */
+	}
 }
 
 bool sys::Userspace::Create(std::unique_ptr<sys::Cpu>&& cpu, const sys::RunConfig& config) {
@@ -455,22 +764,46 @@ bool sys::Userspace::setupCore(wasm::Module& mod) {
 	return core.close();
 }
 void sys::Userspace::coreLoaded() {
-	fStartLoad(pBinaryPath);
+	if (pRestore.empty())
+		fStartLoad(pBinaryPath);
+	else
+		fStartRestore();
 }
 std::vector<env::BlockExport> sys::Userspace::setupBlock(wasm::Module& mod) {
 	/* setup the translator */
 	gen::Block translator{ mod };
+	pWriter.fSetupBlock();
+	pCpu->setupBlock(mod);
 
 	/* translate the next requested address */
 	translator.run(pAddress);
 
-	/* finalize the translation */
-	return translator.close();
+	/* finalize the translation and keep the source to allow the block to be reused */
+	std::vector<env::BlockExport> exports = translator.close();
+	pSource = translator.source();
+	return exports;
+}
+const env::WarmBlock* sys::Userspace::warmBlock() {
+	if (env::Instance()->logBlocks())
+		return 0;
+	const env::WarmBlock* block = detail::WarmCache::LookupBlock(fWarmIdentity(), pAddress);
+	if (block != 0)
+		pProfiler.annotate(block->exports);
+	return block;
+}
+void sys::Userspace::blockProduced(const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports) {
+	pProfiler.annotate(exports);
+	if (!env::Instance()->logBlocks())
+		detail::WarmCache::StoreBlock(fWarmIdentity(), pAddress, pSource, data, exports);
+	pSource = {};
 }
 void sys::Userspace::blockLoaded() {
 	fExecute();
 }
 void sys::Userspace::shutdown() {
+	/* report the profile before the translator, which holds the remaining samples, is released */
+	pProfiler.report();
+
 	/* clearing the system-reference will also release this object */
 	gen::ClearInstance();
 	env::ClearInstance();
@@ -494,3 +827,105 @@ void sys::Userspace::execute() {
 void sys::Userspace::checkContinue() {
 	fCheckContinue();
 }
+int64_t sys::Userspace::checkpoint() {
+	if (pCheckpoint.empty()) {
+		logger.warn(u8"Checkpoint requested without a configured snapshot path");
+		return errCode::eNotImplemented;
+	}
+
+	/* only the state of the single initial thread of the initial process with the standard descriptors can be captured */
+	if (pSyscall.processes().nested()) {
+		logger.warn(u8"Checkpoint cannot be performed by forked processes");
+		return errCode::eBusy;
+	}
+	const detail::ProcessConfig& process = pSyscall.process();
+	if (pSyscall.threads().count() > 1 || process.tid != process.pid) {
+		logger.warn(u8"Checkpoint can only be performed by the single initial thread");
+		return errCode::eBusy;
+	}
+	if (!pSyscall.files().fdOnlyStandard()) {
+		logger.warn(u8"Checkpoint can only be performed with only the standard file-descriptors being opened");
+		return errCode::eBusy;
+	}
+
+	/* capture the state of the environment and syscalls (context is captured before the result is written) */
+	detail::Snapshot snapshot;
+	snapshot.args = pArgs;
+	snapshot.envs = pEnvs;
+	snapshot.cpu = pCpu->name();
+	snapshot.binary = pBinaryPath;
+	snapshot.actual = pBinaryActual;
+	snapshot.process = process;
+	snapshot.brk = pSyscall.memory().breakState();
+	snapshot.context = env::Instance()->context().save();
+	snapshot.pc = pAddress;
+	snapshot.pageSize = env::Instance()->pageSize();
+
+	snapshot.regions = detail::Snapshot::CaptureMemory();
+
+	/* capture the blocks produced for this environment to allow the restored process to start warm */
+	if (!env::Instance()->logBlocks()) {
+		snapshot.blockIdentity = fWarmIdentity();
+		snapshot.blocks = detail::WarmCache::ExportBlocks(snapshot.blockIdentity);
+	}
+	std::shared_ptr<std::vector<uint8_t>> data = std::make_shared<std::vector<uint8_t>>(snapshot.encode());
+	logger.debug(u8"Snapshot captured with [", snapshot.regions.size(), u8"] regions at [", str::As{ U"#018x", pAddress }, u8']');
+
+	/* lookup the snapshot-file or its parent directory to create it */
+	std::u8string actual = util::CanonicalPath(pCheckpoint);
+	auto [_parent, _name] = util::SplitName(actual);
+	env::Instance()->filesystem().readStats(actual, [this, data, parent = std::u8string{ _parent }, name = std::u8string{ _name }](const env::FileStats* stats) {
+		pSyscall.callContinue([this, data, parent, name, stats]() -> int64_t {
+			if (stats != 0)
+				return (stats->type == env::FileType::file ? fWriteSnapshot(stats->id, data) : errCode::eIsDirectory);
+
+			/* create the snapshot-file */
+			env::Instance()->filesystem().readStats(parent, [this, data, name](const env::FileStats* dir) {
+				pSyscall.callContinue([this, data, name, dir]() -> int64_t {
+					if (dir == 0 || dir->type != env::FileType::directory)
+						return errCode::eNoEntry;
+					pSyscall.files().dentries().dropName(dir->id, name);
+					pSyscall.files().dentries().dropNode(dir->id);
+					env::Instance()->filesystem().createFile(dir->id, name, env::FileAccess{ detail::fs::DefOwner, detail::fs::DefGroup, detail::fs::ReadWrite }, [this, data](std::optional<uint64_t> id) {
+						pSyscall.callContinue([this, data, id]() -> int64_t {
+							if (!id.has_value())
+								return errCode::eIO;
+							return fWriteSnapshot(id.value(), data);
+							});
+						});
+					return pSyscall.callIncomplete();
+					});
+				});
+			return pSyscall.callIncomplete();
+			});
+		});
+
+	/* potentially defer the call */
+	return pSyscall.callIncomplete();
+}
+int64_t sys::Userspace::execve(const std::u8string& path, std::vector<std::u8string> args, std::vector<std::u8string> envs) {
+	/* setup the new image (the first argument is passed as path of the binary) */
+	std::shared_ptr<detail::ImageConfig> image = std::make_shared<detail::ImageConfig>();
+	image->binary = (args.empty() ? path : args.front());
+	if (!args.empty())
+		image->args.assign(args.begin() + 1, args.end());
+	image->envs = std::move(envs);
+	image->actual = path;
+
+	/* read the file and load it (current image remains untouched, until the new image has been validated) */
+	return fExecRead(path, 0, [this, image](int64_t result, const std::u8string& actual, const std::vector<uint8_t>& data) -> int64_t {
+		if (result != errCode::eSuccess)
+			return result;
+		return fExecLoaded(image, actual, data, 0);
+		});
+}
+sys::detail::ImageConfig sys::Userspace::image() const {
+	return detail::ImageConfig{ pArgs, pEnvs, pBinaryPath, pBinaryActual, pProfiler.image() };
+}
+void sys::Userspace::restoreImage(const detail::ImageConfig& image) {
+	pArgs = image.args;
+	pEnvs = image.envs;
+	pBinaryPath = image.binary;
+	pBinaryActual = image.actual;
+	pProfiler.restoreImage(image.profile);
+}
@@ -9,6 +9,9 @@
 #include "../syscall/sys-syscall.h"
 #include "../writer/sys-writer.h"
 #include "../elf/sys-elf.h"
+#include "sys-snapshot.h"
+#include "sys-warm.h"
+#include "sys-profiler.h"
 
 namespace sys {
 	/* found to result in the best performance */
@@ -18,7 +21,10 @@ namespace sys {
 		static constexpr env::guest_t StartOfStackAlignment = 128;
 		static constexpr env::guest_t StackSize = 0x80'0000;
 		static constexpr uint32_t PageSize = 0x1000;
-		static constexpr uint32_t MaxProcessCount = 1;
+		static constexpr uint32_t MaxProcessCount = 16;
+
+		/* number of leading bytes read up front, if the binary is populated lazily */
+		static constexpr uint64_t LazyHeaderSize = 0x10000;
 		static constexpr const char8_t* ResolveLocations[] = {
 			u8"", u8"/", u8"/bin/", u8"/lib/"
 		};
@@ -28,6 +34,8 @@ namespace sys {
 		std::vector<std::u8string> args;
 		std::vector<std::u8string> envs;
 		std::u8string binary;
+		std::u8string checkpoint;
+		std::u8string restore;
 		uint32_t translationDepth = sys::DefTranslationDepth;
 		gen::TraceType trace = gen::TraceType::none;
 		bool logBlocks = false;
@@ -37,17 +45,25 @@ namespace sys {
 	*	file to be executed, and passes the calls to the cpu implementation, as well as
 	*	a system-v ABI conform initial stack configuration (only 64 bit support)
 	*	Note: The assumption is made, that the stack grows downwards
-	*	Note: The pc is managed by the userspace object */
+	*	Note: The pc is managed by the userspace object
+	*	Note: Guest-threads are scheduled cooperatively on the single host-thread
+	*	Note: Can checkpoint itself into a snapshot-file and be resumed from it instead of loading the binary
+	*	Note: Forked processes run sequentially within the same environment (see detail::Processes)
+	*	Note: Profiling and perf-maps disable the lazy population of the binary, as the symbols are read from the entire file */
 	class Userspace final : public env::System {
 	private:
 		std::vector<std::u8string> pArgs;
 		std::vector<std::u8string> pEnvs;
 		std::u8string pBinaryPath;
 		std::u8string pBinaryActual;
+		std::u8string pCheckpoint;
+		std::u8string pRestore;
 		elf::LoadState pLoaded;
+		gen::BlockSource pSource;
 		detail::Syscall pSyscall;
 		sys::Debugger pDebugger;
 		sys::Writer pWriter;
+		detail::Profiler pProfiler;
 		sys::Cpu* pCpu = 0;
 		env::guest_t pAddress = 0;
 		size_t pResolveIndex = 0;
@@ -60,10 +76,23 @@ namespace sys {
 	private:
 		bool fSetup(std::unique_ptr<sys::Userspace>&& system, std::unique_ptr<sys::Cpu>&& cpu, const sys::RunConfig& config, bool debug);
 		std::u8string_view fArchType(sys::ArchType architecture) const;
+		sys::ArchType fMachineArch(elf::MachineType machine) const;
 		env::guest_t fPrepareStack() const;
 		void fStartLoad(const std::u8string& path);
-		bool fBinaryLoaded(const std::u8string& actual, const uint8_t* data, size_t size);
+		void fReadBinary(const std::u8string& actual, const env::FileStats& stats, bool lazy);
+		bool fBinaryLoaded(const std::u8string& actual, const uint8_t* data, size_t size, std::optional<elf::FileBacking> backing);
 		bool fLoadCompleted();
+		uint64_t fWarmIdentity() const;
+
+	private:
+		void fStartRestore();
+		bool fSnapshotLoaded(const uint8_t* data, size_t size);
+		int64_t fWriteSnapshot(uint64_t id, std::shared_ptr<std::vector<uint8_t>> data);
+
+	private:
+		int64_t fExecRead(const std::u8string& path, size_t links, std::function<int64_t(int64_t, const std::u8string&, const std::vector<uint8_t>&)> callback);
+		int64_t fExecLoaded(std::shared_ptr<detail::ImageConfig> image, const std::u8string& actual, const std::vector<uint8_t>& data, size_t redirects);
+		int64_t fExecCommit(const detail::ImageConfig& image, const std::u8string& actual, const std::vector<uint8_t>& binary, const std::vector<uint8_t>& interpreter);
 
 	private:
 		void fCheckContinue() const;
@@ -77,6 +106,8 @@ namespace sys {
 		bool setupCore(wasm::Module& mod) final;
 		void coreLoaded() final;
 		std::vector<env::BlockExport> setupBlock(wasm::Module& mod) final;
+		const env::WarmBlock* warmBlock() final;
+		void blockProduced(const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports) final;
 		void blockLoaded() final;
 		void shutdown() final;
 
@@ -87,5 +118,9 @@ namespace sys {
 		void setPC(env::guest_t address);
 		void execute();
 		void checkContinue();
+		int64_t checkpoint();
+		int64_t execve(const std::u8string& path, std::vector<std::u8string> args, std::vector<std::u8string> envs);
+		detail::ImageConfig image() const;
+		void restoreImage(const detail::ImageConfig& image);
 	};
 }
@@ -0,0 +1,212 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#include "../system.h"
+
+static util::Logger logger{ u8"sys::warm" };
+
+namespace global {
+	struct WarmFile {
+		std::vector<uint8_t> data;
+		uint64_t id = 0;
+		uint64_t modified = 0;
+	};
+	struct WarmCode {
+		std::vector<uint8_t> data;
+		env::guest_t address = 0;
+	};
+	struct WarmEntry {
+		env::WarmBlock block;
+		std::vector<WarmCode> code;
+		std::vector<env::guest_t> linked;
+		uint64_t identity = 0;
+	};
+
+	static std::unordered_map<std::u8string, WarmFile> WarmFiles;
+	static std::unordered_multimap<env::guest_t, WarmEntry> WarmBlocks;
+	static uint64_t WarmFileBytes = 0;
+	static uint64_t WarmBlockBytes = 0;
+}
+
+static bool MatchesState(const global::WarmEntry& entry) {
+	const env::Mapping& mapping = env::Instance()->mapping();
+
+	/* check if the exported addresses still need to be produced and the linked addresses still exist */
+	for (const env::BlockExport& exp : entry.block.exports) {
+		if (mapping.contains(exp.address))
+			return false;
+	}
+	for (env::guest_t address : entry.linked) {
+		if (!mapping.contains(address))
+			return false;
+	}
+
+	/* check if the guest-code is still executable and unchanged */
+	std::vector<uint8_t> buffer;
+	for (const global::WarmCode& code : entry.code) {
+		buffer.resize(code.data.size());
+		try {
+			env::Instance()->memory().mread(buffer.data(), code.address, buffer.size(), env::Usage::Execute);
+		}
+		catch (const env::MemoryFault&) {
+			return false;
+		}
+		if (buffer != code.data)
+			return false;
+	}
+	return true;
+}
+
+const std::vector<uint8_t>* sys::detail::WarmCache::LookupFile(const std::u8string& path, const env::FileStats& stats) {
+	auto it = global::WarmFiles.find(path);
+	if (it == global::WarmFiles.end())
+		return 0;
+
+	/* validate that the file has not been modified */
+	if (it->second.id != stats.id || it->second.modified != stats.timeModifiedUS || it->second.data.size() != stats.size)
+		return 0;
+	logger.debug(u8"Reusing warm file [", path, u8']');
+	return &it->second.data;
+}
+void sys::detail::WarmCache::StoreFile(const std::u8string& path, const env::FileStats& stats, const uint8_t* data, size_t size) {
+	if (size > detail::WarmMaxFileBytes)
+		return;
+
+	/* remove any previous version of the file and check if the cache needs to be reset */
+	auto it = global::WarmFiles.find(path);
+	if (it != global::WarmFiles.end()) {
+		global::WarmFileBytes -= it->second.data.size();
+		global::WarmFiles.erase(it);
+	}
+	if (global::WarmFileBytes + size > detail::WarmMaxFileBytes) {
+		logger.debug(u8"Resetting warm files");
+		global::WarmFiles.clear();
+		global::WarmFileBytes = 0;
+	}
+
+	/* register the file */
+	global::WarmFile& file = global::WarmFiles[path];
+	file.data = std::vector<uint8_t>{ data, data + size };
+	file.id = stats.id;
+	file.modified = stats.timeModifiedUS;
+	global::WarmFileBytes += size;
+}
+const env::WarmBlock* sys::detail::WarmCache::LookupBlock(uint64_t identity, env::guest_t address) {
+	auto [begin, end] = global::WarmBlocks.equal_range(address);
+	for (auto it = begin; it != end; ++it) {
+		if (it->second.identity != identity || !MatchesState(it->second))
+			continue;
+		logger.debug(u8"Reusing warm block for [", str::As{ U"#018x", address }, u8']');
+		return &it->second.block;
+	}
+	return 0;
+}
+void sys::detail::WarmCache::StoreBlock(uint64_t identity, env::guest_t address, const gen::BlockSource& source, const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports) {
+	if (!source.reusable)
+		return;
+
+	/* merge the overlapping code-ranges */
+	std::vector<std::pair<env::guest_t, uint64_t>> ranges = source.code;
+	std::sort(ranges.begin(), ranges.end());
+	std::vector<std::pair<env::guest_t, uint64_t>> merged;
+	for (const auto& [start, size] : ranges) {
+		if (!merged.empty() && merged.back().first + merged.back().second >= start)
+			merged.back().second = std::max(merged.back().second, start + size - merged.back().first);
+		else
+			merged.push_back({ start, size });
+	}
+
+	/* snapshot the guest-code (block cannot be reused, if the look-ahead is not accessible) */
+	global::WarmEntry entry;
+	uint64_t total = data.size();
+	for (const auto& [start, size] : merged) {
+		global::WarmCode& code = entry.code.emplace_back();
+		code.address = start;
+		code.data.resize(size);
+		total += size;
+		try {
+			env::Instance()->memory().mread(code.data.data(), start, size, env::Usage::Execute);
+		}
+		catch (const env::MemoryFault&) {
+			return;
+		}
+	}
+	if (total > detail::WarmMaxBlockBytes)
+		return;
+	entry.block.data = data;
+	entry.block.exports = exports;
+	entry.linked = source.linked;
+	entry.identity = identity;
+
+	/* check if the cache needs to be reset */
+	if (global::WarmBlockBytes + total > detail::WarmMaxBlockBytes) {
+		logger.debug(u8"Resetting warm blocks");
+		global::WarmBlocks.clear();
+		global::WarmBlockBytes = 0;
+	}
+	global::WarmBlocks.insert({ address, std::move(entry) });
+	global::WarmBlockBytes += total;
+}
+std::vector<uint8_t> sys::detail::WarmCache::ExportBlocks(uint64_t identity) {
+	detail::SnapshotWriter out;
+
+	/* serialize all blocks, which were produced for the same environment */
+	for (const auto& [address, entry] : global::WarmBlocks) {
+		if (entry.identity != identity)
+			continue;
+		out.u64(address);
+		out.buffer(entry.block.data);
+		out.u64(entry.block.exports.size());
+		for (const env::BlockExport& exp : entry.block.exports) {
+			out.string(exp.name);
+			out.u64(exp.address);
+		}
+		out.u64(entry.code.size());
+		for (const global::WarmCode& code : entry.code) {
+			out.u64(code.address);
+			out.buffer(code.data);
+		}
+		out.u64(entry.linked.size());
+		for (env::guest_t linked : entry.linked)
+			out.u64(linked);
+	}
+	return std::move(out.data());
+}
+bool sys::detail::WarmCache::ImportBlocks(uint64_t identity, const std::vector<uint8_t>& data) {
+	detail::SnapshotReader in{ data.data(), data.size() };
+
+	/* deserialize the blocks (will be validated against the current state before being reused) */
+	while (!in.completed()) {
+		env::guest_t address = in.u64();
+		global::WarmEntry entry;
+		entry.identity = identity;
+		entry.block.data = in.buffer();
+		uint64_t total = entry.block.data.size();
+		for (uint64_t i = in.u64(); i > 0 && !in.failed(); --i) {
+			env::BlockExport& exp = entry.block.exports.emplace_back();
+			exp.name = in.string();
+			exp.address = in.u64();
+		}
+		for (uint64_t i = in.u64(); i > 0 && !in.failed(); --i) {
+			global::WarmCode& code = entry.code.emplace_back();
+			code.address = in.u64();
+			code.data = in.buffer();
+			total += code.data.size();
+		}
+		for (uint64_t i = in.u64(); i > 0 && !in.failed(); --i)
+			entry.linked.push_back(in.u64());
+		if (in.failed())
+			return false;
+
+		/* skip blocks, which are already known from previous processes */
+		auto [begin, end] = global::WarmBlocks.equal_range(address);
+		if (std::any_of(begin, end, [&](const auto& it) { return it.second.identity == identity && it.second.block.data == entry.block.data; }))
+			continue;
+
+		/* register the block, unless the cache is exhausted */
+		if (global::WarmBlockBytes + total > detail::WarmMaxBlockBytes)
+			break;
+		global::WarmBlocks.insert({ address, std::move(entry) });
+		global::WarmBlockBytes += total;
+	}
+	return true;
+}
@@ -0,0 +1,23 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "../sys-common.h"
+
+namespace sys::detail {
+	static constexpr uint64_t WarmMaxFileBytes = 0x0400'0000;
+	static constexpr uint64_t WarmMaxBlockBytes = 0x0400'0000;
+
+	/* process-independent cache of loaded binaries and produced block modules, which outlives
+	*	the userspace to allow subsequent processes to start warm (files are only reused if their
+	*	id, size, and modification-time match, and blocks only if the guest-code and already
+	*	existing blocks they were produced from match, and the core and generator are identical) */
+	struct WarmCache {
+		static const std::vector<uint8_t>* LookupFile(const std::u8string& path, const env::FileStats& stats);
+		static void StoreFile(const std::u8string& path, const env::FileStats& stats, const uint8_t* data, size_t size);
+		static const env::WarmBlock* LookupBlock(uint64_t identity, env::guest_t address);
+		static void StoreBlock(uint64_t identity, env::guest_t address, const gen::BlockSource& source, const std::vector<uint8_t>& data, const std::vector<env::BlockExport>& exports);
+		static std::vector<uint8_t> ExportBlocks(uint64_t identity);
+		static bool ImportBlocks(uint64_t identity, const std::vector<uint8_t>& data);
+	};
+}
@@ -2,20 +2,61 @@
 /* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
 #include "../system.h"
 
+namespace global {
+	/* state written by the translated blocks before invoking the callbacks (static to ensure its address
+	*	remains unchanged across instances, as it is embedded into the produced blocks, which may be reused) */
+	static struct {
+		struct {
+			uint64_t id = 0;
+			env::guest_t address = 0;
+		} exception;
+		struct {
+			env::guest_t address = 0;
+			env::guest_t next = 0;
+		} syscall;
+		uint32_t threaded = 0;
+	} State;
+}
+
 bool sys::Writer::fSetup(detail::Syscall* syscall) {
 	/* register the functions to be invoked by the execution-environment */
 	pRegistered.flushInst = env::Instance()->interact().defineCallback([](uint64_t address) -> uint64_t {
 		throw env::ExecuteDirty{ address };
 		return 0;
 		});
-	pRegistered.exception = env::Instance()->interact().defineCallback([this]() {
-		throw detail::CpuException{ pException.address, pException.id };
+	pRegistered.exception = env::Instance()->interact().defineCallback([]() {
+		throw detail::CpuException{ global::State.exception.address, global::State.exception.id };
+		});
+	pRegistered.syscall = env::Instance()->interact().defineCallback([syscall]() {
+		syscall->handle(global::State.syscall.address, global::State.syscall.next);
 		});
-	pRegistered.syscall = env::Instance()->interact().defineCallback([syscall, this]() {
-		syscall->handle(pSyscall.address, pSyscall.next);
+	pRegistered.syscallFast = env::Instance()->interact().defineCallback([syscall]() {
+		syscall->handleFast(global::State.syscall.address, global::State.syscall.next);
 		});
+
+	/* add the clock-helper to the core, which reads the host-time import directly, and bind it to be imported by the blocks */
+	wasm::Prototype prototype = gen::Module->prototype(u8"host_time_us_type", {}, { wasm::Type::i64 });
+	wasm::Function time = gen::Module->function(u8"host_time_us", prototype, wasm::Import{ u8"host" });
+	prototype = gen::Module->prototype(u8"sys_clock_us_type", {}, { wasm::Type::i64 });
+	{
+		wasm::Sink sink{ gen::Module->function(u8"sys_clock_us", prototype, wasm::Export{}) };
+		sink[I::Call::Direct(time)];
+	}
+	env::Instance()->bindExport(u8"sys_clock_us");
 	return true;
 }
+void sys::Writer::fSetupBlock() {
+	/* import the clock-helper of the core */
+	wasm::Prototype prototype = gen::Module->prototype(u8"sys_clock_us_type", {}, { wasm::Type::i64 });
+	pClock = gen::Module->function(u8"sys_clock_us", prototype, wasm::Import{ env::Instance()->blockImportModule() });
+}
+
+uintptr_t sys::Writer::StateAddress() {
+	return reinterpret_cast<uintptr_t>(&global::State);
+}
+void sys::Writer::SetThreaded(bool threaded) {
+	global::State.threaded = (threaded ? 1 : 0);
+}
 
 void sys::Writer::makeFlushMemCache(env::guest_t address, env::guest_t nextAddress) const {
 	/* nothing to be done here, as the system is considered single-threaded */
@@ -25,29 +66,36 @@ void sys::Writer::makeFlushInstCache(env::guest_t address, env::guest_t nextAddr
 	gen::Make->invokeParam(pRegistered.flushInst);
 	gen::Add[I::Drop()];
 }
-void sys::Writer::makeSyscall(env::guest_t address, env::guest_t nextAddress) {
+void sys::Writer::makeSyscall(env::guest_t address, env::guest_t nextAddress, sys::SyscallIndex index) const {
 	/* write the address to the cache */
-	gen::FulFill fulfill = gen::Make->writeHost(&pSyscall.address, gen::MemoryType::i64);
+	gen::FulFill fulfill = gen::Make->writeHost(&global::State.syscall.address, gen::MemoryType::i64);
 	gen::Add[I::U64::Const(address)];
 	fulfill.now();
 
 	/* write the next address to the cache */
-	fulfill = gen::Make->writeHost(&pSyscall.next, gen::MemoryType::i64);
+	fulfill = gen::Make->writeHost(&global::State.syscall.next, gen::MemoryType::i64);
 	gen::Add[I::U64::Const(nextAddress)];
 	fulfill.now();
 
-	/* perform the syscall-call */
-	gen::Make->invokeVoid(pRegistered.syscall);
-
+	/* perform the direct syscall-call for simple synchronous syscalls, and otherwise the generic syscall-call */
+	gen::Make->invokeVoid(detail::Syscall::IsFast(index) ? pRegistered.syscallFast : pRegistered.syscall);
+}
+void sys::Writer::makeClock() const {
+	/* select the unavailable-marker over the host-time while multiple threads exist (output is
+	*	flushed by the syscalls, and therefore not checked within this path) */
+	gen::Add[I::U64::Const(detail::ClockUnavailable)];
+	gen::Add[I::Call::Direct(pClock)];
+	gen::Make->readHost(&global::State.threaded, gen::MemoryType::i32);
+	gen::Add[I::Select()];
 }
-void sys::Writer::makeException(uint64_t id, env::guest_t address, env::guest_t nextAddress) {
+void sys::Writer::makeException(uint64_t id, env::guest_t address, env::guest_t nextAddress) const {
 	/* write the id to the cache */
-	gen::FulFill fulfill = gen::Make->writeHost(&pException.id, gen::MemoryType::i64);
+	gen::FulFill fulfill = gen::Make->writeHost(&global::State.exception.id, gen::MemoryType::i64);
 	gen::Add[I::U64::Const(id)];
 	fulfill.now();
 
 	/* write the address to the cache */
-	fulfill = gen::Make->writeHost(&pException.address, gen::MemoryType::i64);
+	fulfill = gen::Make->writeHost(&global::State.exception.address, gen::MemoryType::i64);
 	gen::Add[I::U64::Const(address)];
 	fulfill.now();
 
@@ -5,22 +5,22 @@
 #include "../sys-common.h"
 
 namespace sys {
+	namespace detail {
+		/* produced by the clock instead of the host-time, if the actual syscall needs to be performed */
+		static constexpr uint64_t ClockUnavailable = uint64_t(-1);
+	}
+
 	class Writer {
 		friend class sys::Userspace;
+		friend class sys::TranslateBench;
 	private:
-		struct {
-			uint64_t id = 0;
-			env::guest_t address = 0;
-		} pException;
-		struct {
-			env::guest_t address = 0;
-			env::guest_t next = 0;
-		} pSyscall;
 		struct {
 			uint32_t flushInst = 0;
 			uint32_t exception = 0;
 			uint32_t syscall = 0;
+			uint32_t syscallFast = 0;
 		} pRegistered;
+		wasm::Function pClock;
 
 	private:
 		Writer() = default;
@@ -29,6 +29,14 @@ namespace sys {
 
 	private:
 		bool fSetup(detail::Syscall* syscall);
+		void fSetupBlock();
+
+	public:
+		/* address of the state embedded into the translated blocks (must be part of the identity of reused blocks) */
+		static uintptr_t StateAddress();
+
+		/* update whether multiple threads exist, in which case the clock of the blocks is unavailable */
+		static void SetThreaded(bool threaded);
 
 	public:
 		/* generate the code to flush the memory cache
@@ -39,12 +47,17 @@ namespace sys {
 		*	Note: will abort the control-flow */
 		void makeFlushInstCache(env::guest_t address, env::guest_t nextAddress) const;
 
-		/* generate the code to perform a syscall
+		/* generate the code to perform a syscall (simple synchronous syscalls, whose index is known during the
+		*	translation, are performed directly, all others take the generic path, which may unwind the execution)
 		*	Note: may abort the control-flow */
-		void makeSyscall(env::guest_t address, env::guest_t nextAddress);
+		void makeSyscall(env::guest_t address, env::guest_t nextAddress, sys::SyscallIndex index) const;
+
+		/* generate the code to fetch the host-time in microseconds directly from the core (writes [i64] to the stack), or detail::ClockUnavailable
+		*	while multiple threads exist, as they are only switched within actual syscalls (which a spinning thread must reach) */
+		void makeClock() const;
 
 		/* generate the code to throw an exception
 		*	Note: will abort the control-flow */
-		void makeException(uint64_t id, env::guest_t address, env::guest_t nextAddress);
+		void makeException(uint64_t id, env::guest_t address, env::guest_t nextAddress) const;
 	};
 }
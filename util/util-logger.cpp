@@ -2,6 +2,7 @@
 /* Copyright (c) 2025-2026 Bjoern Boss Henrichsen */
 #include "util-logger.h"
 #include "../host/interface.h"
+#include "../host/host-interact.h"
 
 static bool GlobalLogEnabled = true;
 
@@ -24,6 +25,8 @@ util::Logger::Logger(std::u8string_view self) {
 		pFormat = str::u8::Format(u8"[{: <16}] ", self);
 }
 void util::Logger::fLog(std::u8string_view msg, bool fatal) const {
+	/* flush the buffered terminal output to preserve the order of the messages */
+	host::FlushOut();
 	(fatal ? host_failure : host_message)(msg.data(), uint32_t(msg.size()));
 }
 